@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+enum class HugePages
+{
+    None,
+    Transparent,
+    Explicit
+};
+
+template <typename T, std::size_t Alignment = 64, HugePages Pages = HugePages::Transparent>
+class AlignedAllocator
+{
+private:
+    static constexpr std::size_t ALIGNMENT = Alignment > alignof(T) ? Alignment : alignof(T);
+
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+public:
+    static constexpr std::size_t HUGE_PAGE_SIZE = std::size_t(2) << 20;
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment, Pages>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment, Pages>&) noexcept {}
+
+    T* allocate(std::size_t n);
+    void deallocate(T* ptr, std::size_t n) noexcept;
+
+private:
+    static bool isHuge(std::size_t bytes);
+    static std::size_t mappedBytes(std::size_t bytes);
+
+    static void* mapHuge(std::size_t bytes);
+    static void unmapHuge(void* ptr, std::size_t bytes) noexcept;
+};
+
+template <typename T, std::size_t Alignment, HugePages Pages>
+inline T* AlignedAllocator<T, Alignment, Pages>::allocate(std::size_t n)
+{
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+
+    std::size_t bytes = n * sizeof(T);
+
+    if (isHuge(bytes)) return static_cast<T*>(mapHuge(bytes));
+
+    return static_cast<T*>(::operator new(bytes, std::align_val_t(ALIGNMENT)));
+}
+
+template <typename T, std::size_t Alignment, HugePages Pages>
+inline void AlignedAllocator<T, Alignment, Pages>::deallocate(T* ptr, std::size_t n) noexcept
+{
+    if (!ptr) return;
+
+    std::size_t bytes = n * sizeof(T);
+
+    if (isHuge(bytes))
+    {
+        unmapHuge(ptr, bytes);
+        return;
+    }
+
+    ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+}
+
+template <typename T, std::size_t Alignment, HugePages Pages>
+inline bool AlignedAllocator<T, Alignment, Pages>::isHuge(std::size_t bytes)
+{
+#if defined(__linux__)
+    return Pages != HugePages::None && bytes >= HUGE_PAGE_SIZE && ALIGNMENT <= HUGE_PAGE_SIZE;
+#else
+    (void)bytes;
+    return false;
+#endif
+}
+
+template <typename T, std::size_t Alignment, HugePages Pages>
+inline std::size_t AlignedAllocator<T, Alignment, Pages>::mappedBytes(std::size_t bytes)
+{
+    return (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+}
+
+template <typename T, std::size_t Alignment, HugePages Pages>
+inline void* AlignedAllocator<T, Alignment, Pages>::mapHuge(std::size_t bytes)
+{
+#if defined(__linux__)
+    std::size_t length = mappedBytes(bytes);
+
+#if defined(MAP_HUGETLB)
+    if (Pages == HugePages::Explicit)
+    {
+        void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) return ptr;
+    }
+#endif
+
+    void* raw = mmap(nullptr, length + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) throw std::bad_alloc();
+
+    std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(raw);
+    std::uintptr_t aligned = (begin + HUGE_PAGE_SIZE - 1) & ~std::uintptr_t(HUGE_PAGE_SIZE - 1);
+
+    std::size_t headBytes = aligned - begin;
+    std::size_t tailBytes = HUGE_PAGE_SIZE - headBytes;
+
+    if (headBytes) munmap(raw, headBytes);
+    if (tailBytes) munmap(reinterpret_cast<void*>(aligned + length), tailBytes);
+
+    void* ptr = reinterpret_cast<void*>(aligned);
+
+#if defined(MADV_HUGEPAGE)
+    madvise(ptr, length, MADV_HUGEPAGE);
+#endif
+
+    return ptr;
+#else
+    (void)bytes;
+    throw std::bad_alloc();
+#endif
+}
+
+template <typename T, std::size_t Alignment, HugePages Pages>
+inline void AlignedAllocator<T, Alignment, Pages>::unmapHuge(void* ptr, std::size_t bytes) noexcept
+{
+#if defined(__linux__)
+    munmap(ptr, mappedBytes(bytes));
+#else
+    (void)ptr;
+    (void)bytes;
+#endif
+}
+
+template <typename T, typename U, std::size_t Alignment, HugePages Pages>
+inline bool operator==(const AlignedAllocator<T, Alignment, Pages>&, const AlignedAllocator<U, Alignment, Pages>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U, std::size_t Alignment, HugePages Pages>
+inline bool operator!=(const AlignedAllocator<T, Alignment, Pages>&, const AlignedAllocator<U, Alignment, Pages>&) noexcept
+{
+    return false;
+}
@@ -0,0 +1,576 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+#include "../Utility/Bits.hpp"
+
+template <typename T>
+constexpr std::size_t defaultBlockSize()
+{
+    return sizeof(T) <= 256 ? 4096 / Bits::nextPowerOfTwo(sizeof(T)) : 16;
+}
+
+template <typename T, typename Ptr, std::size_t BlockSize>
+class BlockDequeIterator
+{
+private:
+    using Map = T* const*;
+    using Ref = decltype(*std::declval<Ptr>());
+    using Offset = std::ptrdiff_t;
+
+    Map map;
+    std::size_t blocks;
+    std::size_t position;
+
+    Ptr ptr;
+    Ptr blockEnd;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = Offset;
+    using pointer = Ptr;
+    using reference = Ref;
+
+    BlockDequeIterator(Map map, std::size_t blocks, std::size_t position) : map(map), blocks(blocks), position(position), ptr(nullptr), blockEnd(nullptr)
+    {
+        locate();
+    }
+
+    BlockDequeIterator& operator++()
+    {
+        ++position;
+        if (++ptr == blockEnd) locate();
+        return *this;
+    }
+
+    BlockDequeIterator operator++(int)
+    {
+        BlockDequeIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    BlockDequeIterator& operator--()
+    {
+        --position;
+        locate();
+        return *this;
+    }
+
+    BlockDequeIterator operator--(int)
+    {
+        BlockDequeIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    BlockDequeIterator& operator+=(Offset offset)
+    {
+        position = static_cast<std::size_t>(static_cast<Offset>(position) + offset);
+        locate();
+        return *this;
+    }
+
+    BlockDequeIterator& operator-=(Offset offset)
+    {
+        return *this += -offset;
+    }
+
+    BlockDequeIterator operator+(Offset offset) const
+    {
+        BlockDequeIterator temp = *this;
+        temp += offset;
+        return temp;
+    }
+
+    BlockDequeIterator operator-(Offset offset) const
+    {
+        BlockDequeIterator temp = *this;
+        temp -= offset;
+        return temp;
+    }
+
+    Offset operator-(const BlockDequeIterator& other) const
+    {
+        return static_cast<Offset>(position) - static_cast<Offset>(other.position);
+    }
+
+    Ref operator*() const noexcept
+    {
+        return *ptr;
+    }
+
+    Ptr operator->() const noexcept
+    {
+        return ptr;
+    }
+
+    Ref operator[](Offset offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    bool operator==(const BlockDequeIterator& other) const
+    {
+        return position == other.position;
+    }
+
+    bool operator!=(const BlockDequeIterator& other) const
+    {
+        return position != other.position;
+    }
+
+    bool operator<(const BlockDequeIterator& other) const
+    {
+        return position < other.position;
+    }
+
+    bool operator>(const BlockDequeIterator& other) const
+    {
+        return position > other.position;
+    }
+
+    bool operator<=(const BlockDequeIterator& other) const
+    {
+        return position <= other.position;
+    }
+
+    bool operator>=(const BlockDequeIterator& other) const
+    {
+        return position >= other.position;
+    }
+
+private:
+    void locate()
+    {
+        std::size_t idx = position / BlockSize;
+        T* block = idx < blocks ? map[idx] : nullptr;
+
+        if (!block)
+        {
+            ptr = blockEnd = nullptr;
+            return;
+        }
+
+        ptr = block + position % BlockSize;
+        blockEnd = block + BlockSize;
+    }
+};
+
+template <typename T, std::size_t BlockSize = defaultBlockSize<T>(), typename Allocator = std::allocator<T>>
+class BlockDeque
+{
+private:
+    static_assert(Bits::isPowerOfTwo(BlockSize), "BlockSize must be a power of two");
+
+    static constexpr std::size_t MIN_MAP_SIZE = 8;
+
+    using MapAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T*>;
+
+    T** map;
+    std::size_t mapSize;
+
+    std::size_t start;
+    std::size_t size;
+
+    T* spare;
+
+    Allocator allocator;
+    MapAllocator mapAllocator;
+    using AllocatorT = std::allocator_traits<Allocator>;
+
+public:
+    using Iterator = BlockDequeIterator<T, T*, BlockSize>;
+    using ConstIterator = BlockDequeIterator<T, const T*, BlockSize>;
+
+    Iterator begin()
+    {
+        return Iterator(map, mapSize, start);
+    }
+
+    Iterator end()
+    {
+        return Iterator(map, mapSize, start + size);
+    }
+
+    ConstIterator cbegin() const
+    {
+        return ConstIterator(map, mapSize, start);
+    }
+
+    ConstIterator cend() const
+    {
+        return ConstIterator(map, mapSize, start + size);
+    }
+
+public:
+    BlockDeque();
+
+    std::size_t getSize() const;
+    bool isEmpty() const;
+
+    const T& front() const;
+    T& front();
+
+    const T& back() const;
+    T& back();
+
+    const T& operator[](std::size_t idx) const;
+    T& operator[](std::size_t idx);
+
+    BlockDeque<T, BlockSize, Allocator>& push_back(const T& val);
+    BlockDeque<T, BlockSize, Allocator>& push_back(T&& val);
+
+    BlockDeque<T, BlockSize, Allocator>& pop_back();
+
+    BlockDeque<T, BlockSize, Allocator>& push_front(const T& val);
+    BlockDeque<T, BlockSize, Allocator>& push_front(T&& val);
+
+    BlockDeque<T, BlockSize, Allocator>& pop_front();
+
+    template <typename... Args>
+    BlockDeque<T, BlockSize, Allocator>& emplace_back(Args&&... args);
+
+    template <typename... Args>
+    BlockDeque<T, BlockSize, Allocator>& emplace_front(Args&&... args);
+
+    BlockDeque<T, BlockSize, Allocator>& clear();
+
+    BlockDeque(const BlockDeque<T, BlockSize, Allocator>& other);
+    BlockDeque<T, BlockSize, Allocator>& operator=(const BlockDeque<T, BlockSize, Allocator>& other);
+
+    BlockDeque(BlockDeque<T, BlockSize, Allocator>&& other) noexcept;
+    BlockDeque<T, BlockSize, Allocator>& operator=(BlockDeque<T, BlockSize, Allocator>&& other) noexcept;
+
+    ~BlockDeque() noexcept;
+
+private:
+    T* slot(std::size_t position) const;
+
+    T* backSlot();
+    T* frontSlot();
+
+    void acquireBlock(std::size_t block);
+    void releaseBlock(std::size_t block) noexcept;
+
+    void reserveMap();
+
+    void copyFrom(const BlockDeque<T, BlockSize, Allocator>& other);
+    void moveFrom(BlockDeque<T, BlockSize, Allocator>&& other) noexcept;
+    void free() noexcept;
+};
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque()
+    :   map(nullptr),
+        mapSize(0),
+        start(0),
+        size(0),
+        spare(nullptr)
+{
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline std::size_t BlockDeque<T, BlockSize, Allocator>::getSize() const
+{
+    return size;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline bool BlockDeque<T, BlockSize, Allocator>::isEmpty() const
+{
+    return size == 0;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline const T& BlockDeque<T, BlockSize, Allocator>::front() const
+{
+    return *slot(start);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline T& BlockDeque<T, BlockSize, Allocator>::front()
+{
+    return *slot(start);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline const T& BlockDeque<T, BlockSize, Allocator>::back() const
+{
+    return *slot(start + size - 1);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline T& BlockDeque<T, BlockSize, Allocator>::back()
+{
+    return *slot(start + size - 1);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline const T& BlockDeque<T, BlockSize, Allocator>::operator[](std::size_t idx) const
+{
+    return *slot(start + idx);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline T& BlockDeque<T, BlockSize, Allocator>::operator[](std::size_t idx)
+{
+    return *slot(start + idx);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::push_back(const T& val)
+{
+    AllocatorT::construct(allocator, backSlot(), val);
+    size++;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::push_back(T&& val)
+{
+    AllocatorT::construct(allocator, backSlot(), std::move(val));
+    size++;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::pop_back()
+{
+    if (isEmpty()) return *this;
+
+    std::size_t position = start + --size;
+    AllocatorT::destroy(allocator, slot(position));
+
+    if (size == 0 || position % BlockSize == 0) releaseBlock(position / BlockSize);
+
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::push_front(const T& val)
+{
+    AllocatorT::construct(allocator, frontSlot(), val);
+    start--;
+    size++;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::push_front(T&& val)
+{
+    AllocatorT::construct(allocator, frontSlot(), std::move(val));
+    start--;
+    size++;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::pop_front()
+{
+    if (isEmpty()) return *this;
+
+    std::size_t position = start++;
+    AllocatorT::destroy(allocator, slot(position));
+    size--;
+
+    if (size == 0 || start % BlockSize == 0) releaseBlock(position / BlockSize);
+
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+template <typename... Args>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::emplace_back(Args&&... args)
+{
+    AllocatorT::construct(allocator, backSlot(), std::forward<Args>(args)...);
+    size++;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+template <typename... Args>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::emplace_front(Args&&... args)
+{
+    AllocatorT::construct(allocator, frontSlot(), std::forward<Args>(args)...);
+    start--;
+    size++;
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::clear()
+{
+    while (!isEmpty()) pop_back();
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque(const BlockDeque<T, BlockSize, Allocator>& other) : BlockDeque()
+{
+    copyFrom(other);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::operator=(const BlockDeque<T, BlockSize, Allocator>& other)
+{
+    if (this != &other)
+    {
+        free();
+        copyFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque(BlockDeque<T, BlockSize, Allocator>&& other) noexcept
+{
+    moveFrom(std::move(other));
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+BlockDeque<T, BlockSize, Allocator>& BlockDeque<T, BlockSize, Allocator>::operator=(BlockDeque<T, BlockSize, Allocator>&& other) noexcept
+{
+    if (this != &other)
+    {
+        free();
+        moveFrom(std::move(other));
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+BlockDeque<T, BlockSize, Allocator>::~BlockDeque() noexcept
+{
+    free();
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline T* BlockDeque<T, BlockSize, Allocator>::slot(std::size_t position) const
+{
+    return map[position / BlockSize] + position % BlockSize;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline T* BlockDeque<T, BlockSize, Allocator>::backSlot()
+{
+    if (start + size == mapSize * BlockSize) reserveMap();
+
+    std::size_t position = start + size;
+    if (!map[position / BlockSize]) acquireBlock(position / BlockSize);
+
+    return slot(position);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline T* BlockDeque<T, BlockSize, Allocator>::frontSlot()
+{
+    if (start == 0) reserveMap();
+
+    std::size_t position = start - 1;
+    if (!map[position / BlockSize]) acquireBlock(position / BlockSize);
+
+    return slot(position);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline void BlockDeque<T, BlockSize, Allocator>::acquireBlock(std::size_t block)
+{
+    map[block] = spare ? std::exchange(spare, nullptr) : allocator.allocate(BlockSize);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline void BlockDeque<T, BlockSize, Allocator>::releaseBlock(std::size_t block) noexcept
+{
+    T* released = std::exchange(map[block], nullptr);
+
+    if (!spare)
+    {
+        spare = released;
+    }
+    else
+    {
+        allocator.deallocate(released, BlockSize);
+    }
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+void BlockDeque<T, BlockSize, Allocator>::reserveMap()
+{
+    std::size_t firstBlock = start / BlockSize;
+    std::size_t usedBlocks = size ? (start + size - 1) / BlockSize - firstBlock + 1 : 0;
+
+    if (mapSize >= 2 * (usedBlocks + 1))
+    {
+        std::size_t newFirst = (mapSize - usedBlocks) / 2;
+
+        if (newFirst < firstBlock)
+        {
+            std::copy(map + firstBlock, map + firstBlock + usedBlocks, map + newFirst);
+        }
+        else
+        {
+            std::copy_backward(map + firstBlock, map + firstBlock + usedBlocks, map + newFirst + usedBlocks);
+        }
+
+        std::fill(map, map + newFirst, nullptr);
+        std::fill(map + newFirst + usedBlocks, map + mapSize, nullptr);
+
+        start = newFirst * BlockSize + start % BlockSize;
+        return;
+    }
+
+    std::size_t newSize = std::max(MIN_MAP_SIZE, mapSize * 2);
+    while (newSize < 2 * (usedBlocks + 1)) newSize *= 2;
+
+    T** newMap = mapAllocator.allocate(newSize);
+    std::size_t newFirst = (newSize - usedBlocks) / 2;
+
+    std::fill(newMap, newMap + newSize, nullptr);
+    if (map) std::copy(map + firstBlock, map + firstBlock + usedBlocks, newMap + newFirst);
+
+    if (map) mapAllocator.deallocate(map, mapSize);
+
+    map = newMap;
+    mapSize = newSize;
+    start = newFirst * BlockSize + start % BlockSize;
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline void BlockDeque<T, BlockSize, Allocator>::copyFrom(const BlockDeque<T, BlockSize, Allocator>& other)
+{
+    for (std::size_t i = 0; i < other.size; i++)
+    {
+        push_back(other[i]);
+    }
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline void BlockDeque<T, BlockSize, Allocator>::moveFrom(BlockDeque<T, BlockSize, Allocator>&& other) noexcept
+{
+    map = std::exchange(other.map, nullptr);
+    mapSize = std::exchange(other.mapSize, 0);
+    start = std::exchange(other.start, 0);
+    size = std::exchange(other.size, 0);
+    spare = std::exchange(other.spare, nullptr);
+}
+
+template <typename T, std::size_t BlockSize, typename Allocator>
+inline void BlockDeque<T, BlockSize, Allocator>::free() noexcept
+{
+    clear();
+
+    if (spare) allocator.deallocate(spare, BlockSize);
+    if (map) mapAllocator.deallocate(map, mapSize);
+
+    map = nullptr;
+    spare = nullptr;
+    mapSize = start = 0;
+}
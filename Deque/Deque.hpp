@@ -3,6 +3,13 @@
 #include <iostream>
 #include <memory>
 #include <utility>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "../Utility/Bits.hpp"
+#include "../Span/Span.hpp"
 
 template <typename T>
 class DequeIterator;
@@ -35,22 +42,22 @@ public:
     
     Iterator begin()
     {
-        return Iterator(0, *this);
+        return Iterator(data, capacity, head, 0);
     }
 
     Iterator end()
     {
-        return Iterator(size, *this);
+        return Iterator(data, capacity, head, size);
     }
 
-    ConstIterator cbegin()
+    ConstIterator cbegin() const
     {
-        return ConstIterator(0, *this);
+        return ConstIterator(data, capacity, head, 0);
     }
 
-    ConstIterator cend()
+    ConstIterator cend() const
     {
-        return ConstIterator(size, *this);
+        return ConstIterator(data, capacity, head, size);
     }
 
 public:
@@ -88,6 +95,20 @@ public:
     template <typename... Args>
     Deque<T, Allocator>& emplace_front(Args&&... args);
 
+    Deque<T, Allocator>& reserve(std::size_t n);
+
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Deque<T, Allocator>& push_back(InputIt first, InputIt last);
+
+    Deque<T, Allocator>& pop_front(std::size_t n);
+    Deque<T, Allocator>& pop_back(std::size_t n);
+
+    std::pair<Span<T>, Span<T>> getSegments();
+    std::pair<Span<const T>, Span<const T>> getSegments() const;
+
+    std::pair<Span<T>, Span<T>> getFreeSegments();
+    Deque<T, Allocator>& commit_back(std::size_t n);
+
     Deque(const Deque<T, Allocator>& other);
     Deque<T, Allocator>& operator=(const Deque<T, Allocator>& other);
 
@@ -99,6 +120,7 @@ public:
 private:
     void moveIndex(std::size_t& index, bool forward) const;
     std::size_t calculateCapacity() const;
+    std::size_t mask() const;
 
     void resize(std::size_t n);
 
@@ -111,17 +133,41 @@ template <typename T>
 class DequeIterator
 {
 private:
-    friend class Deque<T>;
+    friend class ConstDequeIterator<T>;
+
+    using Ptr = T*;
+    using Ref = T&;
+    using Offset = std::ptrdiff_t;
+
+    Ptr data;
+    Ptr bufferEnd;
+    Ptr ptr;
 
+    std::size_t mask;
+    std::size_t head;
     std::size_t index;
-    Deque<T>& deque;
 
 public:
-    DequeIterator(std::size_t index, Deque<T>& deque) : index(index), deque(deque) {}
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = Offset;
+    using pointer = Ptr;
+    using reference = Ref;
+
+    DequeIterator(Ptr data, std::size_t capacity, std::size_t head, std::size_t index)
+        :   data(data),
+            bufferEnd(data + capacity),
+            ptr(data + ((head + index) & (capacity - 1))),
+            mask(capacity - 1),
+            head(head),
+            index(index)
+    {
+    }
 
     DequeIterator<T>& operator++()
     {
         ++index;
+        if (++ptr == bufferEnd) ptr = data;
         return *this;
     }
 
@@ -135,6 +181,8 @@ public:
     DequeIterator<T>& operator--()
     {
         --index;
+        if (ptr == data) ptr = bufferEnd;
+        --ptr;
         return *this;
     }
 
@@ -145,42 +193,125 @@ public:
         return temp;
     }
 
-    T& operator*()
+    DequeIterator<T>& operator+=(Offset offset)
+    {
+        index = static_cast<std::size_t>(static_cast<Offset>(index) + offset);
+        ptr = data + ((head + index) & mask);
+        return *this;
+    }
+
+    DequeIterator<T>& operator-=(Offset offset)
+    {
+        return *this += -offset;
+    }
+
+    DequeIterator<T> operator+(Offset offset) const
+    {
+        DequeIterator<T> temp = *this;
+        temp += offset;
+        return temp;
+    }
+
+    DequeIterator<T> operator-(Offset offset) const
+    {
+        DequeIterator<T> temp = *this;
+        temp -= offset;
+        return temp;
+    }
+
+    Offset operator-(const DequeIterator<T>& other) const
     {
-        return deque[index];
+        return static_cast<Offset>(index) - static_cast<Offset>(other.index);
     }
 
-    T* operator->()
+    Ref operator*() const noexcept
     {
-        return &operator*();
+        return *ptr;
     }
 
-    bool operator==(const DequeIterator& other) const
+    Ptr operator->() const noexcept
     {
-        return index == other.index && &deque == &other.deque;
+        return ptr;
     }
 
-    bool operator!=(const DequeIterator& other) const
+    Ref operator[](Offset offset) const noexcept
+    {
+        return data[(head + index + static_cast<std::size_t>(offset)) & mask];
+    }
+
+    bool operator==(const DequeIterator<T>& other) const
+    {
+        return index == other.index && data == other.data;
+    }
+
+    bool operator!=(const DequeIterator<T>& other) const
     {
         return !(*this == other);
     }
+
+    bool operator<(const DequeIterator<T>& other) const
+    {
+        return index < other.index;
+    }
+
+    bool operator>(const DequeIterator<T>& other) const
+    {
+        return index > other.index;
+    }
+
+    bool operator<=(const DequeIterator<T>& other) const
+    {
+        return index <= other.index;
+    }
+
+    bool operator>=(const DequeIterator<T>& other) const
+    {
+        return index >= other.index;
+    }
 };
 
 template <typename T>
 class ConstDequeIterator
 {
 private:
-    friend class Deque<T>;
+    using Ptr = const T*;
+    using Ref = const T&;
+    using Offset = std::ptrdiff_t;
 
+    Ptr data;
+    Ptr bufferEnd;
+    Ptr ptr;
+
+    std::size_t mask;
+    std::size_t head;
     std::size_t index;
-    const Deque<T>& deque;
 
 public:
-    ConstDequeIterator(std::size_t index, const Deque<T>& deque) : index(index), deque(deque) {}
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = Offset;
+    using pointer = Ptr;
+    using reference = Ref;
+
+    ConstDequeIterator(Ptr data, std::size_t capacity, std::size_t head, std::size_t index)
+        :   data(data),
+            bufferEnd(data + capacity),
+            ptr(data + ((head + index) & (capacity - 1))),
+            mask(capacity - 1),
+            head(head),
+            index(index)
+    {
+    }
+
+    ConstDequeIterator(const DequeIterator<T>& other)
+        :   ConstDequeIterator(other.data, other.mask + 1, other.head, other.index)
+    {
+    }
 
     ConstDequeIterator<T>& operator++()
     {
         ++index;
+        if (++ptr == bufferEnd) ptr = data;
         return *this;
     }
 
@@ -194,6 +325,8 @@ public:
     ConstDequeIterator<T>& operator--()
     {
         --index;
+        if (ptr == data) ptr = bufferEnd;
+        --ptr;
         return *this;
     }
 
@@ -204,25 +337,81 @@ public:
         return temp;
     }
 
-    const T& operator*() const
+    ConstDequeIterator<T>& operator+=(Offset offset)
+    {
+        index = static_cast<std::size_t>(static_cast<Offset>(index) + offset);
+        ptr = data + ((head + index) & mask);
+        return *this;
+    }
+
+    ConstDequeIterator<T>& operator-=(Offset offset)
+    {
+        return *this += -offset;
+    }
+
+    ConstDequeIterator<T> operator+(Offset offset) const
+    {
+        ConstDequeIterator<T> temp = *this;
+        temp += offset;
+        return temp;
+    }
+
+    ConstDequeIterator<T> operator-(Offset offset) const
+    {
+        ConstDequeIterator<T> temp = *this;
+        temp -= offset;
+        return temp;
+    }
+
+    Offset operator-(const ConstDequeIterator<T>& other) const
+    {
+        return static_cast<Offset>(index) - static_cast<Offset>(other.index);
+    }
+
+    Ref operator*() const noexcept
+    {
+        return *ptr;
+    }
+
+    Ptr operator->() const noexcept
     {
-        return deque[index];
+        return ptr;
     }
 
-    const T* operator->() const
+    Ref operator[](Offset offset) const noexcept
     {
-        return &operator*();
+        return data[(head + index + static_cast<std::size_t>(offset)) & mask];
     }
 
-    bool operator==(const ConstDequeIterator& other) const
+    bool operator==(const ConstDequeIterator<T>& other) const
     {
-        return index == other.index && &deque == &other.deque;
+        return index == other.index && data == other.data;
     }
 
-    bool operator!=(const ConstDequeIterator& other) const
+    bool operator!=(const ConstDequeIterator<T>& other) const
     {
         return !(*this == other);
     }
+
+    bool operator<(const ConstDequeIterator<T>& other) const
+    {
+        return index < other.index;
+    }
+
+    bool operator>(const ConstDequeIterator<T>& other) const
+    {
+        return index > other.index;
+    }
+
+    bool operator<=(const ConstDequeIterator<T>& other) const
+    {
+        return index <= other.index;
+    }
+
+    bool operator>=(const ConstDequeIterator<T>& other) const
+    {
+        return index >= other.index;
+    }
 };
 
 template <typename T, typename Allocator>
@@ -237,12 +426,14 @@ Deque<T, Allocator>::Deque()
 
 template <typename T, typename Allocator>
 Deque<T, Allocator>::Deque(std::size_t n)
-    :   data(allocator.allocate(n)), 
+    :   data(nullptr), 
         size(n), 
-        capacity(n),
+        capacity(n ? Bits::nextPowerOfTwo(n) : 0),
         head(0),
-        tail(n == 0 ? 0 : n - 1)
+        tail(n & mask())
 {
+    if (capacity) data = allocator.allocate(capacity);
+
     for (std::size_t i = 0; i < size; i++)
     {
         AllocatorT::construct(allocator, &data[i]);
@@ -251,12 +442,14 @@ Deque<T, Allocator>::Deque(std::size_t n)
 
 template <typename T, typename Allocator>
 Deque<T, Allocator>::Deque(std::size_t n, const T& val)
-    :   data(allocator.allocate(n)), 
+    :   data(nullptr), 
         size(n), 
-        capacity(n),
+        capacity(n ? Bits::nextPowerOfTwo(n) : 0),
         head(0),
-        tail(n == 0 ? 0 : n - 1)
+        tail(n & mask())
 {
+    if (capacity) data = allocator.allocate(capacity);
+
     for (std::size_t i = 0; i < size; i++)
     {
         AllocatorT::construct(allocator, &data[i], val);
@@ -284,13 +477,13 @@ inline bool Deque<T, Allocator>::isEmpty() const
 template <typename T, typename Allocator>
 inline const T& Deque<T, Allocator>::operator[](std::size_t idx) const
 {
-    return data[(head + idx) % capacity];
+    return data[(head + idx) & mask()];
 }
 
 template <typename T, typename Allocator>
 inline T& Deque<T, Allocator>::operator[](std::size_t idx)
 {
-    return data[(head + idx) % capacity];
+    return data[(head + idx) & mask()];
 }
 
 template <typename T, typename Allocator>
@@ -308,13 +501,13 @@ T& Deque<T, Allocator>::front()
 template <typename T, typename Allocator>
 const T& Deque<T, Allocator>::back() const
 {
-    return data[(tail == 0 ? capacity : tail) - 1];
+    return data[(tail - 1) & mask()];
 }
 
 template <typename T, typename Allocator>
 T& Deque<T, Allocator>::back()
 {
-    return data[(tail == 0 ? capacity : tail) - 1];
+    return data[(tail - 1) & mask()];
 }
 
 template <typename T, typename Allocator>
@@ -415,42 +608,156 @@ inline Deque<T, Allocator>& Deque<T, Allocator>::emplace_front(Args&&... args)
     return *this;
 }
 
+template <typename T, typename Allocator>
+inline Deque<T, Allocator>& Deque<T, Allocator>::reserve(std::size_t n)
+{
+    if (n > capacity) resize(n);
+    return *this;
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+Deque<T, Allocator>& Deque<T, Allocator>::push_back(InputIt first, InputIt last)
+{
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value)
+    {
+        for (; first != last; ++first) push_back(*first);
+        return *this;
+    }
+    else
+    {
+        std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (size + n > capacity) resize(std::max(size + n, calculateCapacity()));
+
+        std::pair<Span<T>, Span<T>> free = getFreeSegments();
+
+        for (Span<T> segment : { free.first, free.second })
+        {
+            std::size_t count = std::min(n, segment.getSize());
+
+            if constexpr (std::is_trivially_copyable<T>::value && std::is_pointer<InputIt>::value
+                && std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>::value)
+            {
+                if (count) std::memcpy(segment.getData(), first, count * sizeof(T));
+                first += count;
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; i++, ++first)
+                {
+                    AllocatorT::construct(allocator, &segment[i], *first);
+                }
+            }
+
+            tail = (tail + count) & mask();
+            size += count;
+            n -= count;
+        }
+
+        return *this;
+    }
+}
+
+template <typename T, typename Allocator>
+inline Deque<T, Allocator>& Deque<T, Allocator>::pop_front(std::size_t n)
+{
+    n = std::min(n, size);
+
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            AllocatorT::destroy(allocator, &data[(head + i) & mask()]);
+        }
+    }
+
+    if (n) head = (head + n) & mask();
+    size -= n;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline Deque<T, Allocator>& Deque<T, Allocator>::pop_back(std::size_t n)
+{
+    n = std::min(n, size);
+
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            AllocatorT::destroy(allocator, &data[(tail - i) & mask()]);
+        }
+    }
+
+    if (n) tail = (tail - n) & mask();
+    size -= n;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline std::pair<Span<T>, Span<T>> Deque<T, Allocator>::getSegments()
+{
+    std::size_t first = std::min(size, capacity - head);
+    return { Span<T>(data + head, first), Span<T>(data, size - first) };
+}
+
+template <typename T, typename Allocator>
+inline std::pair<Span<const T>, Span<const T>> Deque<T, Allocator>::getSegments() const
+{
+    std::size_t first = std::min(size, capacity - head);
+    return { Span<const T>(data + head, first), Span<const T>(data, size - first) };
+}
+
+template <typename T, typename Allocator>
+inline std::pair<Span<T>, Span<T>> Deque<T, Allocator>::getFreeSegments()
+{
+    std::size_t free = capacity - size;
+    std::size_t first = std::min(free, capacity - tail);
+    return { Span<T>(data + tail, first), Span<T>(data, free - first) };
+}
+
+template <typename T, typename Allocator>
+inline Deque<T, Allocator>& Deque<T, Allocator>::commit_back(std::size_t n)
+{
+    static_assert(std::is_trivial<T>::value, "commit_back requires a trivial type");
+
+    n = std::min(n, capacity - size);
+
+    if (n) tail = (tail + n) & mask();
+    size += n;
+    return *this;
+}
+
 template <typename T, typename Allocator>
 inline void Deque<T, Allocator>::resize(std::size_t n)
 {
     if (n == 0) n = calculateCapacity();
+    n = Bits::nextPowerOfTwo(n);
 
     T* newData = allocator.allocate(n);
 
     std::size_t elements = std::min(n, size);
     for (std::size_t i = 0; i < elements; i++)
     {
-        std::size_t idx = (head + i) % capacity;
+        std::size_t idx = (head + i) & mask();
         AllocatorT::construct(allocator, &newData[i], std::move(data[idx]));
         AllocatorT::destroy(allocator, &data[idx]);
     }
 
-    allocator.deallocate(data, capacity);
+    if (data) allocator.deallocate(data, capacity);
 
     data = newData;
     head = 0;
-    tail = size;
+    tail = size & (n - 1);
     capacity = n;
 }
 
 template <typename T, typename Allocator>
 void Deque<T, Allocator>::moveIndex(std::size_t& index, bool forward) const
 {
-    if (capacity == 0) return;
-
-    if (forward)
-	{
-		(++index) %= capacity;
-	}
-	else
-	{
-		index = (index == 0) ? capacity - 1 : index - 1;
-	}
+    index = (forward ? index + 1 : index - 1) & mask();
 }
 
 template <typename T, typename Allocator>
@@ -459,6 +766,12 @@ inline std::size_t Deque<T, Allocator>::calculateCapacity() const
     return capacity ? capacity * Constants::GROWTH_FACTOR : 1;
 }
 
+template <typename T, typename Allocator>
+inline std::size_t Deque<T, Allocator>::mask() const
+{
+    return capacity - 1;
+}
+
 template <typename T, typename Allocator>
 Deque<T, Allocator>::Deque(const Deque<T, Allocator>& other)
 {
@@ -504,18 +817,17 @@ Deque<T, Allocator>::~Deque() noexcept
 template <typename T, typename Allocator>
 inline void Deque<T, Allocator>::copyFrom(const Deque<T, Allocator>& other)
 {
-    allocator.allocate(other.capacity);
+    data = other.capacity ? allocator.allocate(other.capacity) : nullptr;
 
     for (std::size_t i = 0; i < other.size; i++)
     {
-        std::size_t idx = (head + i) % capacity;
-        AllocatorT::construct(allocator, &data[idx], other[i]);
+        AllocatorT::construct(allocator, &data[i], other[i]);
     }
 
     size = other.size;
     capacity = other.capacity;
     head = 0;
-    tail = size > 0 ? size - 1 : 0;
+    tail = size & mask();
 }
 
 template <typename T, typename Allocator>
@@ -533,11 +845,11 @@ inline void Deque<T, Allocator>::free() noexcept
 {
     for (std::size_t i = 0; i < size; i++)
     {
-        std::size_t idx = (head + i) % capacity;
+        std::size_t idx = (head + i) & mask();
         AllocatorT::destroy(allocator, &data[idx]);
     }
 
-    allocator.deallocate(data, capacity);
+    if (data) allocator.deallocate(data, capacity);
     data = nullptr;
     size = 0;
     capacity = 0;
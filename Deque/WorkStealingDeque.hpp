@@ -0,0 +1,214 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "../Utility/Bits.hpp"
+#include "../Utility/Hardware.hpp"
+
+template <typename T, typename Allocator = std::allocator<T>>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque requires a trivially copyable T");
+
+private:
+    static constexpr std::size_t DEFAULT_CAPACITY = 64;
+    static constexpr std::size_t GROWTH_FACTOR = 2;
+
+    struct Buffer
+    {
+        std::atomic<T>* cells;
+        std::size_t capacity;
+        std::size_t mask;
+        Buffer* retired;
+
+        T load(std::ptrdiff_t idx) const
+        {
+            return cells[static_cast<std::size_t>(idx) & mask].load(std::memory_order_relaxed);
+        }
+
+        void store(std::ptrdiff_t idx, const T& val)
+        {
+            cells[static_cast<std::size_t>(idx) & mask].store(val, std::memory_order_relaxed);
+        }
+    };
+
+    using CellAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::atomic<T>>;
+    using BufferAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Buffer>;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t> top;
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t> bottom;
+    std::atomic<Buffer*> buffer;
+
+    CellAllocator cellAllocator;
+    BufferAllocator bufferAllocator;
+
+public:
+    explicit WorkStealingDeque(std::size_t n = DEFAULT_CAPACITY);
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+
+    WorkStealingDeque<T, Allocator>& push_back(const T& val);
+    bool pop_back(T& out);
+
+    bool steal(T& out);
+
+    WorkStealingDeque(const WorkStealingDeque<T, Allocator>& other) = delete;
+    WorkStealingDeque<T, Allocator>& operator=(const WorkStealingDeque<T, Allocator>& other) = delete;
+
+    ~WorkStealingDeque() noexcept;
+
+private:
+    Buffer* createBuffer(std::size_t capacity, Buffer* retired);
+    Buffer* grow(Buffer* current, std::ptrdiff_t head, std::ptrdiff_t tail);
+};
+
+template <typename T, typename Allocator>
+WorkStealingDeque<T, Allocator>::WorkStealingDeque(std::size_t n) : top(0), bottom(0), buffer(nullptr)
+{
+    buffer.store(createBuffer(Bits::nextPowerOfTwo(std::max<std::size_t>(n, 2)), nullptr), std::memory_order_relaxed);
+}
+
+template <typename T, typename Allocator>
+inline std::size_t WorkStealingDeque<T, Allocator>::getSize() const
+{
+    std::ptrdiff_t tail = bottom.load(std::memory_order_relaxed);
+    std::ptrdiff_t head = top.load(std::memory_order_relaxed);
+    return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+}
+
+template <typename T, typename Allocator>
+inline std::size_t WorkStealingDeque<T, Allocator>::getCapacity() const
+{
+    return buffer.load(std::memory_order_relaxed)->capacity;
+}
+
+template <typename T, typename Allocator>
+inline bool WorkStealingDeque<T, Allocator>::isEmpty() const
+{
+    return getSize() == 0;
+}
+
+template <typename T, typename Allocator>
+inline WorkStealingDeque<T, Allocator>& WorkStealingDeque<T, Allocator>::push_back(const T& val)
+{
+    std::ptrdiff_t tail = bottom.load(std::memory_order_relaxed);
+    std::ptrdiff_t head = top.load(std::memory_order_acquire);
+    Buffer* current = buffer.load(std::memory_order_relaxed);
+
+    if (static_cast<std::size_t>(tail - head) >= current->capacity)
+    {
+        current = grow(current, head, tail);
+    }
+
+    current->store(tail, val);
+    bottom.store(tail + 1, std::memory_order_release);
+
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline bool WorkStealingDeque<T, Allocator>::pop_back(T& out)
+{
+    std::ptrdiff_t tail = bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* current = buffer.load(std::memory_order_relaxed);
+
+    bottom.store(tail, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::ptrdiff_t head = top.load(std::memory_order_relaxed);
+
+    if (head > tail)
+    {
+        bottom.store(tail + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    out = current->load(tail);
+    if (head < tail) return true;
+
+    bool won = top.compare_exchange_strong(head, head + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom.store(tail + 1, std::memory_order_relaxed);
+
+    return won;
+}
+
+template <typename T, typename Allocator>
+inline bool WorkStealingDeque<T, Allocator>::steal(T& out)
+{
+    std::ptrdiff_t head = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t tail = bottom.load(std::memory_order_acquire);
+
+    if (head >= tail) return false;
+
+    T val = buffer.load(std::memory_order_acquire)->load(head);
+    if (!top.compare_exchange_strong(head, head + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return false;
+
+    out = val;
+    return true;
+}
+
+template <typename T, typename Allocator>
+WorkStealingDeque<T, Allocator>::~WorkStealingDeque() noexcept
+{
+    Buffer* current = buffer.load(std::memory_order_relaxed);
+
+    while (current)
+    {
+        Buffer* retired = current->retired;
+
+        for (std::size_t i = 0; i < current->capacity; i++)
+        {
+            current->cells[i].~atomic();
+        }
+
+        cellAllocator.deallocate(current->cells, current->capacity);
+
+        current->~Buffer();
+        bufferAllocator.deallocate(current, 1);
+
+        current = retired;
+    }
+}
+
+template <typename T, typename Allocator>
+typename WorkStealingDeque<T, Allocator>::Buffer* WorkStealingDeque<T, Allocator>::createBuffer(std::size_t capacity, Buffer* retired)
+{
+    Buffer* created = bufferAllocator.allocate(1);
+    ::new (static_cast<void*>(created)) Buffer();
+
+    created->cells = cellAllocator.allocate(capacity);
+    created->capacity = capacity;
+    created->mask = capacity - 1;
+    created->retired = retired;
+
+    for (std::size_t i = 0; i < capacity; i++)
+    {
+        ::new (static_cast<void*>(&created->cells[i])) std::atomic<T>();
+    }
+
+    return created;
+}
+
+template <typename T, typename Allocator>
+typename WorkStealingDeque<T, Allocator>::Buffer* WorkStealingDeque<T, Allocator>::grow(Buffer* current, std::ptrdiff_t head, std::ptrdiff_t tail)
+{
+    Buffer* grown = createBuffer(current->capacity * GROWTH_FACTOR, current);
+
+    for (std::ptrdiff_t i = head; i < tail; i++)
+    {
+        grown->store(i, current->load(i));
+    }
+
+    buffer.store(grown, std::memory_order_release);
+    return grown;
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <exception>
+#include <optional>
+
+#include <future>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+namespace Parallel
+{
+    constexpr std::size_t MIN_GRAIN = 1 << 14;
+
+    namespace Detail
+    {
+        inline std::size_t chunkCount(const ThreadPool& pool, std::size_t n)
+        {
+            std::size_t byGrain = (n + MIN_GRAIN - 1) / MIN_GRAIN;
+            return std::max<std::size_t>(1, std::min(pool.getSize() + 1, byGrain));
+        }
+
+        inline std::size_t chunkBound(std::size_t n, std::size_t chunks, std::size_t idx)
+        {
+            return n / chunks * idx + std::min(idx, n % chunks);
+        }
+
+        template <typename F>
+        void invoke(ThreadPool& pool, std::size_t count, const F& func)
+        {
+            std::vector<std::future<void>> pending;
+            pending.reserve(count);
+
+            std::exception_ptr error;
+
+            try
+            {
+                for (std::size_t i = 1; i < count; i++)
+                {
+                    pending.push_back(pool.submit([&func, i]() { func(i); }));
+                }
+
+                if (count) func(0);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            for (std::future<void>& task : pending)
+            {
+                while (task.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                {
+                    if (!pool.run_pending()) break;
+                }
+
+                try
+                {
+                    task.get();
+                }
+                catch (...)
+                {
+                    if (!error) error = std::current_exception();
+                }
+            }
+
+            if (error) std::rethrow_exception(error);
+        }
+
+        template <typename F>
+        void forChunks(ThreadPool& pool, std::size_t n, std::size_t chunks, const F& func)
+        {
+            invoke(pool, chunks, [&](std::size_t chunk)
+            {
+                func(chunkBound(n, chunks, chunk), chunkBound(n, chunks, chunk + 1));
+            });
+        }
+
+        template <typename It>
+        std::size_t distance(It first, It last)
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+
+        template <typename It>
+        It advance(It it, std::size_t offset)
+        {
+            return it + static_cast<typename std::iterator_traits<It>::difference_type>(offset);
+        }
+    }
+
+    template <typename It, typename F>
+    void for_each(ThreadPool& pool, It first, It last, F func)
+    {
+        std::size_t n = Detail::distance(first, last);
+
+        Detail::forChunks(pool, n, Detail::chunkCount(pool, n), [&](std::size_t begin, std::size_t end)
+        {
+            std::for_each(Detail::advance(first, begin), Detail::advance(first, end), func);
+        });
+    }
+
+    template <typename It, typename OutIt, typename F>
+    OutIt transform(ThreadPool& pool, It first, It last, OutIt out, F func)
+    {
+        std::size_t n = Detail::distance(first, last);
+
+        Detail::forChunks(pool, n, Detail::chunkCount(pool, n), [&](std::size_t begin, std::size_t end)
+        {
+            std::transform(Detail::advance(first, begin), Detail::advance(first, end), Detail::advance(out, begin), func);
+        });
+
+        return Detail::advance(out, n);
+    }
+
+    template <typename It, typename T, typename F = std::plus<>>
+    T reduce(ThreadPool& pool, It first, It last, T init, F func = F())
+    {
+        std::size_t n = Detail::distance(first, last);
+        std::size_t chunks = Detail::chunkCount(pool, n);
+
+        std::vector<std::optional<T>> partials(chunks);
+
+        Detail::invoke(pool, chunks, [&](std::size_t chunk)
+        {
+            std::size_t begin = Detail::chunkBound(n, chunks, chunk);
+            std::size_t end = Detail::chunkBound(n, chunks, chunk + 1);
+
+            if (begin == end) return;
+
+            It it = Detail::advance(first, begin);
+            T acc = *it;
+
+            for (++it; it != Detail::advance(first, end); ++it)
+            {
+                acc = func(std::move(acc), *it);
+            }
+
+            partials[chunk].emplace(std::move(acc));
+        });
+
+        for (std::optional<T>& partial : partials)
+        {
+            if (partial) init = func(std::move(init), std::move(*partial));
+        }
+
+        return init;
+    }
+
+    template <typename It, typename Compare = std::less<>>
+    void sort(ThreadPool& pool, It first, It last, Compare compare = Compare())
+    {
+        std::size_t n = Detail::distance(first, last);
+        std::size_t chunks = Detail::chunkCount(pool, n);
+
+        if (chunks <= 1)
+        {
+            std::sort(first, last, compare);
+            return;
+        }
+
+        std::vector<std::size_t> bounds(chunks + 1);
+        for (std::size_t i = 0; i <= chunks; i++)
+        {
+            bounds[i] = Detail::chunkBound(n, chunks, i);
+        }
+
+        Detail::invoke(pool, chunks, [&](std::size_t chunk)
+        {
+            std::sort(Detail::advance(first, bounds[chunk]), Detail::advance(first, bounds[chunk + 1]), compare);
+        });
+
+        while (bounds.size() > 2)
+        {
+            std::size_t runs = bounds.size() - 1;
+
+            Detail::invoke(pool, runs / 2, [&](std::size_t pair)
+            {
+                std::inplace_merge(
+                    Detail::advance(first, bounds[2 * pair]),
+                    Detail::advance(first, bounds[2 * pair + 1]),
+                    Detail::advance(first, bounds[2 * pair + 2]),
+                    compare);
+            });
+
+            std::vector<std::size_t> merged;
+            merged.reserve(runs / 2 + 2);
+
+            for (std::size_t i = 0; i < bounds.size(); i += 2)
+            {
+                merged.push_back(bounds[i]);
+            }
+
+            if (merged.back() != n) merged.push_back(n);
+
+            bounds = std::move(merged);
+        }
+    }
+
+    template <typename It, typename F>
+    void for_each(It first, It last, F func)
+    {
+        for_each(ThreadPool::instance(), first, last, std::move(func));
+    }
+
+    template <typename It, typename OutIt, typename F>
+    OutIt transform(It first, It last, OutIt out, F func)
+    {
+        return transform(ThreadPool::instance(), first, last, out, std::move(func));
+    }
+
+    template <typename It, typename T, typename F = std::plus<>>
+    T reduce(It first, It last, T init, F func = F())
+    {
+        return reduce(ThreadPool::instance(), first, last, std::move(init), std::move(func));
+    }
+
+    template <typename It, typename Compare = std::less<>>
+    void sort(It first, It last, Compare compare = Compare())
+    {
+        sort(ThreadPool::instance(), first, last, std::move(compare));
+    }
+}
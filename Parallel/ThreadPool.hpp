@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <deque>
+#include <vector>
+
+#include <functional>
+#include <future>
+#include <memory>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+class ThreadPool
+{
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopping;
+
+public:
+    explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency());
+
+    std::size_t getSize() const;
+
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& func);
+
+    bool run_pending();
+
+    static ThreadPool& instance();
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    ~ThreadPool() noexcept;
+
+private:
+    void run();
+};
+
+inline ThreadPool::ThreadPool(std::size_t threads) : stopping(false)
+{
+    if (threads == 0) threads = 1;
+
+    workers.reserve(threads);
+    for (std::size_t i = 0; i < threads; i++)
+    {
+        workers.emplace_back(&ThreadPool::run, this);
+    }
+}
+
+inline std::size_t ThreadPool::getSize() const
+{
+    return workers.size();
+}
+
+template <typename F>
+inline std::future<std::invoke_result_t<std::decay_t<F>>> ThreadPool::submit(F&& func)
+{
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+    std::future<Result> result = task->get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.emplace_back([task]() { (*task)(); });
+    }
+
+    condition.notify_one();
+    return result;
+}
+
+inline bool ThreadPool::run_pending()
+{
+    std::function<void()> task;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty()) return false;
+
+        task = std::move(tasks.front());
+        tasks.pop_front();
+    }
+
+    task();
+    return true;
+}
+
+inline ThreadPool& ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+inline ThreadPool::~ThreadPool() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    condition.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+inline void ThreadPool::run()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+            if (tasks.empty()) return;
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        task();
+    }
+}
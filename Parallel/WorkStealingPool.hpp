@@ -0,0 +1,387 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <deque>
+#include <vector>
+
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "../Deque/WorkStealingDeque.hpp"
+#include "../Utility/Hardware.hpp"
+
+class WorkStealingPool
+{
+public:
+    class TaskGroup;
+
+private:
+    static constexpr std::size_t SPIN_COUNT = 64;
+    static constexpr std::size_t NO_WORKER = static_cast<std::size_t>(-1);
+
+    struct Task
+    {
+        std::function<void()> func;
+        TaskGroup* group;
+    };
+
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> queues;
+    std::vector<std::thread> workers;
+
+    std::deque<Task*> injected;
+    std::atomic<std::size_t> injectedCount;
+
+    std::atomic<std::size_t> pending;
+    std::atomic<std::size_t> sleepers;
+    std::atomic<bool> stopping;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::condition_variable finished;
+
+    inline static thread_local WorkStealingPool* currentPool = nullptr;
+    inline static thread_local std::size_t currentIndex = NO_WORKER;
+
+public:
+    explicit WorkStealingPool(std::size_t threads = std::thread::hardware_concurrency());
+
+    std::size_t getSize() const;
+
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& func);
+
+    void wait();
+
+    template <typename F1, typename F2>
+    void invoke(F1&& left, F2&& right);
+
+    static WorkStealingPool& instance();
+
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+
+    ~WorkStealingPool() noexcept;
+
+private:
+    std::size_t workerIndex() const;
+
+    void schedule(Task* task);
+    Task* findTask(std::size_t index);
+    void execute(Task* task);
+
+    bool hasWork() const;
+    void run(std::size_t index);
+};
+
+class WorkStealingPool::TaskGroup
+{
+private:
+    WorkStealingPool& pool;
+    std::atomic<std::size_t> pending;
+
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    friend class WorkStealingPool;
+
+public:
+    explicit TaskGroup(WorkStealingPool& owner = WorkStealingPool::instance());
+
+    template <typename F>
+    TaskGroup& run(F&& func);
+
+    void wait();
+
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+
+    ~TaskGroup() noexcept;
+
+private:
+    void join();
+    void fail(std::exception_ptr raised);
+};
+
+inline WorkStealingPool::WorkStealingPool(std::size_t threads) : injectedCount(0), pending(0), sleepers(0), stopping(false)
+{
+    if (threads == 0) threads = 1;
+
+    queues.reserve(threads);
+    for (std::size_t i = 0; i < threads; i++)
+    {
+        queues.emplace_back(std::make_unique<WorkStealingDeque<Task*>>());
+    }
+
+    workers.reserve(threads);
+    for (std::size_t i = 0; i < threads; i++)
+    {
+        workers.emplace_back(&WorkStealingPool::run, this, i);
+    }
+}
+
+inline std::size_t WorkStealingPool::getSize() const
+{
+    return workers.size();
+}
+
+template <typename F>
+inline std::future<std::invoke_result_t<std::decay_t<F>>> WorkStealingPool::submit(F&& func)
+{
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+    std::future<Result> result = task->get_future();
+
+    schedule(new Task{ [task]() { (*task)(); }, nullptr });
+    return result;
+}
+
+inline void WorkStealingPool::wait()
+{
+    if (workerIndex() != NO_WORKER) throw std::logic_error("WorkStealingPool::wait called from a worker thread");
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() { return pending.load(std::memory_order_acquire) == 0; });
+}
+
+template <typename F1, typename F2>
+inline void WorkStealingPool::invoke(F1&& left, F2&& right)
+{
+    TaskGroup group(*this);
+
+    group.run(std::forward<F2>(right));
+
+    try
+    {
+        std::forward<F1>(left)();
+    }
+    catch (...)
+    {
+        group.fail(std::current_exception());
+    }
+
+    group.wait();
+}
+
+inline WorkStealingPool& WorkStealingPool::instance()
+{
+    static WorkStealingPool pool;
+    return pool;
+}
+
+inline WorkStealingPool::~WorkStealingPool() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping.store(true, std::memory_order_relaxed);
+    }
+
+    condition.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+inline std::size_t WorkStealingPool::workerIndex() const
+{
+    return currentPool == this ? currentIndex : NO_WORKER;
+}
+
+inline void WorkStealingPool::schedule(Task* task)
+{
+    pending.fetch_add(1, std::memory_order_relaxed);
+    if (task->group) task->group->pending.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t index = workerIndex();
+
+    if (index != NO_WORKER)
+    {
+        queues[index]->push_back(task);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        injected.push_back(task);
+        injectedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (sleepers.load(std::memory_order_relaxed) == 0) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+
+    condition.notify_one();
+}
+
+inline WorkStealingPool::Task* WorkStealingPool::findTask(std::size_t index)
+{
+    Task* task = nullptr;
+
+    if (index != NO_WORKER && queues[index]->pop_back(task)) return task;
+
+    std::size_t count = queues.size();
+    std::size_t start = index != NO_WORKER ? index + 1 : 0;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        std::size_t victim = (start + i) % count;
+        if (victim != index && queues[victim]->steal(task)) return task;
+    }
+
+    if (injectedCount.load(std::memory_order_relaxed) == 0) return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (injected.empty()) return nullptr;
+
+    task = injected.front();
+    injected.pop_front();
+    injectedCount.fetch_sub(1, std::memory_order_relaxed);
+
+    return task;
+}
+
+inline void WorkStealingPool::execute(Task* task)
+{
+    TaskGroup* group = task->group;
+
+    try
+    {
+        task->func();
+    }
+    catch (...)
+    {
+        if (group) group->fail(std::current_exception());
+    }
+
+    delete task;
+
+    if (group) group->pending.fetch_sub(1, std::memory_order_acq_rel);
+
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+
+        finished.notify_all();
+    }
+}
+
+inline bool WorkStealingPool::hasWork() const
+{
+    if (injectedCount.load(std::memory_order_relaxed) != 0) return true;
+
+    for (const std::unique_ptr<WorkStealingDeque<Task*>>& queue : queues)
+    {
+        if (!queue->isEmpty()) return true;
+    }
+
+    return false;
+}
+
+inline void WorkStealingPool::run(std::size_t index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    while (true)
+    {
+        Task* task = nullptr;
+
+        for (std::size_t i = 0; i < SPIN_COUNT && !task; i++)
+        {
+            task = findTask(index);
+            if (!task) Hardware::pause();
+        }
+
+        if (task)
+        {
+            execute(task);
+            continue;
+        }
+
+        sleepers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopping.load(std::memory_order_relaxed) || hasWork(); });
+        }
+
+        sleepers.fetch_sub(1);
+
+        if (stopping.load(std::memory_order_relaxed) && !hasWork()) return;
+    }
+}
+
+inline WorkStealingPool::TaskGroup::TaskGroup(WorkStealingPool& owner) : pool(owner), pending(0)
+{
+}
+
+template <typename F>
+inline WorkStealingPool::TaskGroup& WorkStealingPool::TaskGroup::run(F&& func)
+{
+    pool.schedule(new Task{ std::function<void()>(std::forward<F>(func)), this });
+    return *this;
+}
+
+inline void WorkStealingPool::TaskGroup::wait()
+{
+    join();
+
+    std::exception_ptr raised;
+
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        raised = std::exchange(error, nullptr);
+    }
+
+    if (raised) std::rethrow_exception(raised);
+}
+
+inline WorkStealingPool::TaskGroup::~TaskGroup() noexcept
+{
+    join();
+}
+
+inline void WorkStealingPool::TaskGroup::join()
+{
+    std::size_t index = pool.workerIndex();
+
+    while (pending.load(std::memory_order_acquire) != 0)
+    {
+        Task* task = pool.findTask(index);
+
+        if (task)
+        {
+            pool.execute(task);
+        }
+        else
+        {
+            Hardware::pause();
+            std::this_thread::yield();
+        }
+    }
+}
+
+inline void WorkStealingPool::TaskGroup::fail(std::exception_ptr raised)
+{
+    std::lock_guard<std::mutex> lock(errorMutex);
+    if (!error) error = raised;
+}
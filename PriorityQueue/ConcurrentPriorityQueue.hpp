@@ -0,0 +1,197 @@
+#pragma once
+
+#include <iostream>
+
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <vector>
+
+#include "PriorityQueue.hpp"
+#include "../Utility/Hardware.hpp"
+
+// MultiQueue: elements are spread over several locked heaps and try_pop takes the better
+// top of two randomly chosen heaps. Ordering is relaxed: a popped element is close to the
+// global top in rank on average but is not guaranteed to be it, and elements from one
+// producer may be popped out of priority order. try_pop returns false only when the element
+// count or a full scan of all heaps found the queue empty.
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class ConcurrentPriorityQueue
+{
+private:
+    static constexpr std::size_t DEFAULT_SHARDS_PER_THREAD = 2;
+
+    struct alignas(Hardware::CACHE_LINE_SIZE) Shard
+    {
+        std::mutex mutex;
+        PriorityQueue<T, std::vector<T>, Compare, Arity> heap;
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    std::size_t shardCount;
+
+    Compare compare;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::size_t> size;
+
+public:
+    explicit ConcurrentPriorityQueue(std::size_t threads = std::thread::hardware_concurrency(), std::size_t shardsPerThread = DEFAULT_SHARDS_PER_THREAD);
+
+    std::size_t getSize() const;
+    std::size_t getShardCount() const;
+
+    bool isEmpty() const;
+
+    ConcurrentPriorityQueue<T, Compare, Arity>& push(const T& val);
+    ConcurrentPriorityQueue<T, Compare, Arity>& push(T&& val);
+
+    template <typename... Args>
+    ConcurrentPriorityQueue<T, Compare, Arity>& emplace(Args&&... args);
+
+    bool try_pop(T& out);
+
+    ConcurrentPriorityQueue(const ConcurrentPriorityQueue<T, Compare, Arity>& other) = delete;
+    ConcurrentPriorityQueue<T, Compare, Arity>& operator=(const ConcurrentPriorityQueue<T, Compare, Arity>& other) = delete;
+
+private:
+    std::size_t randomShard() const;
+    Shard& lockRandomShard();
+
+    bool popScan(T& out);
+};
+
+template <typename T, typename Compare, std::size_t Arity>
+ConcurrentPriorityQueue<T, Compare, Arity>::ConcurrentPriorityQueue(std::size_t threads, std::size_t shardsPerThread)
+    :   shards(nullptr),
+        shardCount(std::max<std::size_t>(std::max<std::size_t>(threads, 1) * shardsPerThread, 2)),
+        size(0)
+{
+    shards = std::make_unique<Shard[]>(shardCount);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t ConcurrentPriorityQueue<T, Compare, Arity>::getSize() const
+{
+    return size.load(std::memory_order_relaxed);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t ConcurrentPriorityQueue<T, Compare, Arity>::getShardCount() const
+{
+    return shardCount;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool ConcurrentPriorityQueue<T, Compare, Arity>::isEmpty() const
+{
+    return getSize() == 0;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline ConcurrentPriorityQueue<T, Compare, Arity>& ConcurrentPriorityQueue<T, Compare, Arity>::push(const T& val)
+{
+    return emplace(val);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline ConcurrentPriorityQueue<T, Compare, Arity>& ConcurrentPriorityQueue<T, Compare, Arity>::push(T&& val)
+{
+    return emplace(std::move(val));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename... Args>
+ConcurrentPriorityQueue<T, Compare, Arity>& ConcurrentPriorityQueue<T, Compare, Arity>::emplace(Args&&... args)
+{
+    T val(std::forward<Args>(args)...);
+
+    Shard& shard = lockRandomShard();
+    std::lock_guard<std::mutex> lock(shard.mutex, std::adopt_lock);
+
+    shard.heap.push(std::move(val));
+    size.fetch_add(1, std::memory_order_relaxed);
+
+    return *this;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+bool ConcurrentPriorityQueue<T, Compare, Arity>::try_pop(T& out)
+{
+    if (isEmpty()) return false;
+
+    Shard& first = lockRandomShard();
+    std::unique_lock<std::mutex> firstLock(first.mutex, std::adopt_lock);
+
+    Shard& second = shards[randomShard()];
+    std::unique_lock<std::mutex> secondLock(second.mutex, std::defer_lock);
+
+    Shard* best = &first;
+
+    if (&second != &first && secondLock.try_lock() && !second.heap.empty())
+    {
+        if (first.heap.empty() || compare(first.heap.top(), second.heap.top())) best = &second;
+    }
+
+    if (!best->heap.empty())
+    {
+        best->heap.pop(out);
+        size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    firstLock.unlock();
+    if (secondLock.owns_lock()) secondLock.unlock();
+
+    return popScan(out);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t ConcurrentPriorityQueue<T, Compare, Arity>::randomShard() const
+{
+    thread_local std::uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return static_cast<std::size_t>(state % shardCount);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline typename ConcurrentPriorityQueue<T, Compare, Arity>::Shard& ConcurrentPriorityQueue<T, Compare, Arity>::lockRandomShard()
+{
+    while (true)
+    {
+        Shard& shard = shards[randomShard()];
+        if (shard.mutex.try_lock()) return shard;
+
+        Hardware::pause();
+    }
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+bool ConcurrentPriorityQueue<T, Compare, Arity>::popScan(T& out)
+{
+    std::size_t start = randomShard();
+
+    for (std::size_t i = 0; i < shardCount; i++)
+    {
+        Shard& shard = shards[(start + i) % shardCount];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        if (!shard.heap.empty())
+        {
+            shard.heap.pop(out);
+            size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <iostream>
+
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+
+#include <vector>
+
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 2>
+class IndexedPriorityQueue
+{
+    static_assert(Arity >= 2, "IndexedPriorityQueue requires an arity of at least 2");
+
+public:
+    struct Handle
+    {
+        std::size_t index;
+        std::size_t generation;
+
+        bool operator==(const Handle& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const Handle& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+private:
+    static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+    struct Slot
+    {
+        std::optional<T> value;
+        std::size_t position;
+        std::size_t generation;
+    };
+
+    std::vector<std::size_t> heap;
+    std::vector<Slot> slots;
+    std::vector<std::size_t> freeSlots;
+
+    Compare compare;
+
+public:
+    std::size_t size() const;
+    bool empty() const;
+
+    bool contains(Handle handle) const;
+
+    Handle push(const T& val);
+    Handle push(T&& val);
+
+    template <typename... Args>
+    Handle emplace(Args&&... args);
+
+    IndexedPriorityQueue<T, Compare, Arity>& pop();
+
+    const T& top() const;
+    Handle top_handle() const;
+
+    const T& get(Handle handle) const;
+
+    IndexedPriorityQueue<T, Compare, Arity>& update(Handle handle, const T& val);
+    IndexedPriorityQueue<T, Compare, Arity>& update(Handle handle, T&& val);
+
+    IndexedPriorityQueue<T, Compare, Arity>& erase(Handle handle);
+
+    IndexedPriorityQueue<T, Compare, Arity>& reserve(std::size_t n);
+    IndexedPriorityQueue<T, Compare, Arity>& clear();
+
+private:
+    std::size_t acquire();
+    void release(std::size_t index);
+
+    std::size_t locate(Handle handle) const;
+
+    template <typename U>
+    void assign(Handle handle, U&& val);
+
+    bool higher(std::size_t lhs, std::size_t rhs) const;
+    void place(std::size_t position, std::size_t index);
+
+    void sift_up(std::size_t position);
+    void sift_down(std::size_t position);
+};
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t IndexedPriorityQueue<T, Compare, Arity>::size() const
+{
+    return heap.size();
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool IndexedPriorityQueue<T, Compare, Arity>::empty() const
+{
+    return size() == 0;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool IndexedPriorityQueue<T, Compare, Arity>::contains(Handle handle) const
+{
+    return handle.index < slots.size() && slots[handle.index].generation == handle.generation && slots[handle.index].position != NPOS;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::push(const T& val)
+{
+    return emplace(val);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::push(T&& val)
+{
+    return emplace(std::move(val));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename... Args>
+inline typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::emplace(Args&&... args)
+{
+    std::size_t index = acquire();
+    slots[index].value.emplace(std::forward<Args>(args)...);
+
+    heap.push_back(index);
+    place(heap.size() - 1, index);
+    sift_up(heap.size() - 1);
+
+    return Handle{ index, slots[index].generation };
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline IndexedPriorityQueue<T, Compare, Arity>& IndexedPriorityQueue<T, Compare, Arity>::pop()
+{
+    if (empty()) return *this;
+    return erase(top_handle());
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline const T& IndexedPriorityQueue<T, Compare, Arity>::top() const
+{
+    return *slots[heap.front()].value;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::top_handle() const
+{
+    return Handle{ heap.front(), slots[heap.front()].generation };
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline const T& IndexedPriorityQueue<T, Compare, Arity>::get(Handle handle) const
+{
+    return *slots[locate(handle)].value;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline IndexedPriorityQueue<T, Compare, Arity>& IndexedPriorityQueue<T, Compare, Arity>::update(Handle handle, const T& val)
+{
+    assign(handle, val);
+    return *this;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline IndexedPriorityQueue<T, Compare, Arity>& IndexedPriorityQueue<T, Compare, Arity>::update(Handle handle, T&& val)
+{
+    assign(handle, std::move(val));
+    return *this;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+IndexedPriorityQueue<T, Compare, Arity>& IndexedPriorityQueue<T, Compare, Arity>::erase(Handle handle)
+{
+    std::size_t index = locate(handle);
+    std::size_t position = slots[index].position;
+
+    std::size_t last = heap.back();
+    heap.pop_back();
+
+    if (position < heap.size())
+    {
+        place(position, last);
+        sift_up(position);
+        sift_down(slots[last].position);
+    }
+
+    release(index);
+
+    return *this;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline IndexedPriorityQueue<T, Compare, Arity>& IndexedPriorityQueue<T, Compare, Arity>::reserve(std::size_t n)
+{
+    heap.reserve(n);
+    slots.reserve(n);
+    return *this;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline IndexedPriorityQueue<T, Compare, Arity>& IndexedPriorityQueue<T, Compare, Arity>::clear()
+{
+    for (std::size_t index : heap)
+    {
+        release(index);
+    }
+
+    heap.clear();
+    return *this;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t IndexedPriorityQueue<T, Compare, Arity>::acquire()
+{
+    if (freeSlots.empty())
+    {
+        slots.push_back(Slot{ std::nullopt, NPOS, 0 });
+        return slots.size() - 1;
+    }
+
+    std::size_t index = freeSlots.back();
+    freeSlots.pop_back();
+    return index;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline void IndexedPriorityQueue<T, Compare, Arity>::release(std::size_t index)
+{
+    slots[index].value.reset();
+    slots[index].position = NPOS;
+    slots[index].generation++;
+    freeSlots.push_back(index);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t IndexedPriorityQueue<T, Compare, Arity>::locate(Handle handle) const
+{
+    if (!contains(handle)) throw std::out_of_range("IndexedPriorityQueue handle is not queued");
+    return handle.index;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename U>
+inline void IndexedPriorityQueue<T, Compare, Arity>::assign(Handle handle, U&& val)
+{
+    std::size_t index = locate(handle);
+
+    bool raised = compare(*slots[index].value, val);
+    *slots[index].value = std::forward<U>(val);
+
+    if (raised) sift_up(slots[index].position);
+    else sift_down(slots[index].position);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool IndexedPriorityQueue<T, Compare, Arity>::higher(std::size_t lhs, std::size_t rhs) const
+{
+    return compare(*slots[rhs].value, *slots[lhs].value);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline void IndexedPriorityQueue<T, Compare, Arity>::place(std::size_t position, std::size_t index)
+{
+    heap[position] = index;
+    slots[index].position = position;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline void IndexedPriorityQueue<T, Compare, Arity>::sift_up(std::size_t position)
+{
+    std::size_t index = heap[position];
+
+    while (position != 0)
+    {
+        std::size_t parentPosition = (position - 1) / Arity;
+        if (!higher(index, heap[parentPosition])) break;
+
+        place(position, heap[parentPosition]);
+        position = parentPosition;
+    }
+
+    place(position, index);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline void IndexedPriorityQueue<T, Compare, Arity>::sift_down(std::size_t position)
+{
+    std::size_t index = heap[position];
+    std::size_t n = heap.size();
+
+    while (true)
+    {
+        std::size_t first = (Arity * position) + 1;
+        if (first >= n) break;
+
+        std::size_t child = first;
+        std::size_t last = std::min(first + Arity, n);
+
+        for (std::size_t i = first + 1; i < last; i++)
+        {
+            if (higher(heap[i], heap[child])) child = i;
+        }
+
+        if (!higher(heap[child], index)) break;
+
+        place(position, heap[child]);
+        position = child;
+    }
+
+    place(position, index);
+}
@@ -5,129 +5,301 @@
 #include <utility>
 #include <functional>
 #include <algorithm>
+#include <iterator>
+#include <type_traits>
 
 #include <vector>
 
-template <typename T, typename Container = std::vector<T>, typename Compare = std::less<typename Container::value_type>>
+template <typename T, typename Container = std::vector<T>, typename Compare = std::less<typename Container::value_type>, std::size_t Arity = 2>
 class PriorityQueue
 {
+    static_assert(Arity >= 2, "PriorityQueue requires an arity of at least 2");
+
 private:
     Container container;
     Compare compare;
 
 public:
+    PriorityQueue();
+    explicit PriorityQueue(const Compare& compare);
+
+    template <typename InputIt>
+    PriorityQueue(InputIt first, InputIt last, const Compare& compare = Compare());
+
     std::size_t size() const;
     bool empty() const;
 
-    PriorityQueue<T>& push(const T& val);
-    PriorityQueue<T>& push(T&& val);
+    PriorityQueue<T, Container, Compare, Arity>& push(const T& val);
+    PriorityQueue<T, Container, Compare, Arity>& push(T&& val);
 
-    PriorityQueue<T>& pop();
+    PriorityQueue<T, Container, Compare, Arity>& pop();
+    PriorityQueue<T, Container, Compare, Arity>& pop(T& out);
+
+    PriorityQueue<T, Container, Compare, Arity>& replace_top(const T& val);
+    PriorityQueue<T, Container, Compare, Arity>& replace_top(T&& val);
 
     const T& top() const;
 
     template <typename... Args>
-    PriorityQueue<T>& emplace(Args&&... args);
+    PriorityQueue<T, Container, Compare, Arity>& emplace(Args&&... args);
+
+    template <typename InputIt>
+    PriorityQueue<T, Container, Compare, Arity>& push_range(InputIt first, InputIt last);
+
+    PriorityQueue<T, Container, Compare, Arity>& reserve(std::size_t n);
 
 private:
-    void sift_up(int index);
-    void sift_down(int index);
+    void heapify();
+
+    void sift_up(std::size_t index);
+    void sift_down(std::size_t index, T&& val);
+
+    std::size_t select_child(std::size_t first, std::size_t n) const;
 };
 
-template <typename T, typename Container, typename Compare>
-inline std::size_t PriorityQueue<T, Container, Compare>::size() const
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue() : container(), compare()
+{
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(const Compare& compare) : container(), compare(compare)
+{
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+template <typename InputIt>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(InputIt first, InputIt last, const Compare& compare) : container(first, last), compare(compare)
+{
+    heapify();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline std::size_t PriorityQueue<T, Container, Compare, Arity>::size() const
 {
     return container.size();
 }
 
-template <typename T, typename Container, typename Compare>
-inline bool PriorityQueue<T, Container, Compare>::empty() const
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline bool PriorityQueue<T, Container, Compare, Arity>::empty() const
 {
     return size() == 0;
 }
 
-template <typename T, typename Container, typename Compare>
-inline PriorityQueue<T>& PriorityQueue<T, Container, Compare>::push(const T& val)
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::push(const T& val)
 {
     container.push_back(val);
-    sift_up(static_cast<int>(container.size() - 1));
+    sift_up(container.size() - 1);
     return *this;
 }
 
-template <typename T, typename Container, typename Compare>
-inline PriorityQueue<T>& PriorityQueue<T, Container, Compare>::push(T&& val)
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::push(T&& val)
 {
     container.push_back(std::move(val));
-    sift_up(static_cast<int>(container.size() - 1));
+    sift_up(container.size() - 1);
     return *this;
 }
 
-template <typename T, typename Container, typename Compare>
-PriorityQueue<T>& PriorityQueue<T, Container, Compare>::pop()
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::pop()
 {
     if (empty()) return *this;
 
-    std::swap(container.front(), container.back());
+    T val = std::move(container.back());
     container.pop_back();
 
-    if (!empty()) sift_down(0);
+    if (!empty()) sift_down(0, std::move(val));
 
     return *this;
 }
 
-template <typename T, typename Container, typename Compare>
-inline const T& PriorityQueue<T, Container, Compare>::top() const
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::pop(T& out)
+{
+    if (empty()) return *this;
+
+    out = std::move(container.front());
+    return pop();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::replace_top(const T& val)
+{
+    if (empty()) return push(val);
+
+    sift_down(0, T(val));
+    return *this;
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::replace_top(T&& val)
+{
+    if (empty()) return push(std::move(val));
+
+    sift_down(0, std::move(val));
+    return *this;
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline const T& PriorityQueue<T, Container, Compare, Arity>::top() const
 {
     return container.front();
 }
 
-template <typename T, typename Container, typename Compare>
+template <typename T, typename Container, typename Compare, std::size_t Arity>
 template <typename... Args>
-inline PriorityQueue<T>& PriorityQueue<T, Container, Compare>::emplace(Args&&... args)
+inline PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::emplace(Args&&... args)
 {
-    container.push_back(std::forward<Args>(args)...);
-    sift_up(static_cast<int>(container.size() - 1));
+    container.emplace_back(std::forward<Args>(args)...);
+    sift_up(container.size() - 1);
     return *this;
 }
 
-template <typename T, typename Container, typename Compare>
-inline void PriorityQueue<T, Container, Compare>::sift_up(int index)
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+template <typename InputIt>
+PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::push_range(InputIt first, InputIt last)
 {
-    if (index != 0)
+    std::size_t n = container.size();
+
+    if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value)
     {
-        int parentIndex = (index - 1) / 2;
+        reserve(n + static_cast<std::size_t>(std::distance(first, last)));
+    }
+
+    container.insert(container.end(), first, last);
 
-        if (compare(container[parentIndex], container[index]))
+    std::size_t added = container.size() - n;
+
+    if (added >= n)
+    {
+        heapify();
+    }
+    else
+    {
+        for (std::size_t i = n; i < container.size(); i++)
         {
-            std::swap(container[parentIndex], container[index]);
-            sift_up(parentIndex);
+            sift_up(i);
         }
     }
+
+    return *this;
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline PriorityQueue<T, Container, Compare, Arity>& PriorityQueue<T, Container, Compare, Arity>::reserve(std::size_t n)
+{
+    container.reserve(n);
+    return *this;
 }
 
-template <typename T, typename Container, typename Compare>
-inline void PriorityQueue<T, Container, Compare>::sift_down(int idx)
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::heapify()
 {
-    int index = idx;
+    std::size_t n = container.size();
+    if (n < 2) return;
 
-    int left = (2 * idx) + 1;
-    int right = (2 * idx) + 2;
+    for (std::size_t i = (n - 2) / Arity + 1; i-- > 0;)
+    {
+        sift_down(i, T(std::move(container[i])));
+    }
+}
 
-    int n = static_cast<int>(container.size());
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline void PriorityQueue<T, Container, Compare, Arity>::sift_up(std::size_t index)
+{
+    T val = std::move(container[index]);
 
-    if (left < n && compare(container[index], container[left]))
+    while (index != 0)
     {
-        index = left;
+        std::size_t parentIndex = (index - 1) / Arity;
+        if (!compare(container[parentIndex], val)) break;
+
+        container[index] = std::move(container[parentIndex]);
+        index = parentIndex;
     }
 
-    if (right < n && compare(container[index], container[right]))
+    container[index] = std::move(val);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline void PriorityQueue<T, Container, Compare, Arity>::sift_down(std::size_t index, T&& val)
+{
+    std::size_t n = container.size();
+
+    while (true)
     {
-        index = right;
+        std::size_t child = (Arity * index) + 1;
+        if (child >= n) break;
+
+        child = select_child(child, n);
+        if (!compare(val, container[child])) break;
+
+        container[index] = std::move(container[child]);
+        index = child;
     }
 
-    if (index != idx)
+    container[index] = std::move(val);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+inline std::size_t PriorityQueue<T, Container, Compare, Arity>::select_child(std::size_t first, std::size_t n) const
+{
+    std::size_t count = std::min(Arity, n - first);
+    std::size_t best = first;
+
+    if constexpr (std::is_arithmetic<T>::value)
     {
-        std::swap(container[index], container[idx]);
-        sift_down(index);
+        T bestVal = container[first];
+
+        if (count == Arity)
+        {
+            std::size_t indices[Arity];
+            T values[Arity];
+
+            for (std::size_t i = 0; i < Arity; i++)
+            {
+                indices[i] = first + i;
+                values[i] = container[first + i];
+            }
+
+            for (std::size_t width = Arity; width > 1;)
+            {
+                std::size_t upper = (width + 1) / 2;
+
+                for (std::size_t i = 0; i + upper < width; i++)
+                {
+                    bool better = compare(values[i], values[i + upper]);
+
+                    indices[i] = better ? indices[i + upper] : indices[i];
+                    values[i] = better ? values[i + upper] : values[i];
+                }
+
+                width = upper;
+            }
+
+            best = indices[0];
+        }
+        else
+        {
+            for (std::size_t i = 1; i < count; i++)
+            {
+                T childVal = container[first + i];
+                bool better = compare(bestVal, childVal);
+
+                best = better ? first + i : best;
+                bestVal = better ? childVal : bestVal;
+            }
+        }
     }
+    else
+    {
+        for (std::size_t i = 1; i < count; i++)
+        {
+            if (compare(container[best], container[first + i])) best = first + i;
+        }
+    }
+
+    return best;
 }
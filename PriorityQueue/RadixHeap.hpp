@@ -0,0 +1,229 @@
+#pragma once
+
+#include <iostream>
+
+#include <utility>
+#include <climits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <array>
+#include <vector>
+
+#include "../Utility/Bits.hpp"
+
+template <typename T, typename = void>
+struct RadixKey;
+
+template <typename T>
+struct RadixKey<T, std::enable_if_t<std::is_unsigned<T>::value>>
+{
+    using Key = T;
+
+    static Key get(const T& val)
+    {
+        return val;
+    }
+};
+
+template <typename K, typename V>
+struct RadixKey<std::pair<K, V>, std::enable_if_t<std::is_unsigned<K>::value>>
+{
+    using Key = K;
+
+    static Key get(const std::pair<K, V>& val)
+    {
+        return val.first;
+    }
+};
+
+template <typename T, typename KeyOf = RadixKey<T>>
+class RadixHeap
+{
+public:
+    using Key = typename KeyOf::Key;
+
+private:
+    static_assert(std::is_unsigned<Key>::value && sizeof(Key) <= sizeof(std::size_t), "RadixHeap requires an unsigned key no wider than size_t");
+
+    static constexpr std::size_t BUCKETS = sizeof(Key) * CHAR_BIT + 1;
+
+    std::array<std::vector<T>, BUCKETS> buckets;
+    std::array<std::size_t, BUCKETS> minimum;
+    Key last;
+
+    std::size_t count;
+    std::size_t topBucket;
+
+public:
+    RadixHeap();
+
+    std::size_t size() const;
+    bool empty() const;
+
+    RadixHeap<T, KeyOf>& push(const T& val);
+    RadixHeap<T, KeyOf>& push(T&& val);
+
+    template <typename... Args>
+    RadixHeap<T, KeyOf>& emplace(Args&&... args);
+
+    RadixHeap<T, KeyOf>& pop();
+    RadixHeap<T, KeyOf>& pop(T& out);
+
+    const T& top() const;
+
+    RadixHeap<T, KeyOf>& clear();
+
+private:
+    std::size_t bucketOf(Key key) const;
+    void insert(std::size_t idx, T&& val);
+
+    void refill();
+    void locateTop();
+};
+
+template <typename T, typename KeyOf>
+RadixHeap<T, KeyOf>::RadixHeap() : buckets(), minimum(), last(0), count(0), topBucket(0)
+{
+}
+
+template <typename T, typename KeyOf>
+inline std::size_t RadixHeap<T, KeyOf>::size() const
+{
+    return count;
+}
+
+template <typename T, typename KeyOf>
+inline bool RadixHeap<T, KeyOf>::empty() const
+{
+    return count == 0;
+}
+
+template <typename T, typename KeyOf>
+inline RadixHeap<T, KeyOf>& RadixHeap<T, KeyOf>::push(const T& val)
+{
+    return emplace(val);
+}
+
+template <typename T, typename KeyOf>
+inline RadixHeap<T, KeyOf>& RadixHeap<T, KeyOf>::push(T&& val)
+{
+    return emplace(std::move(val));
+}
+
+template <typename T, typename KeyOf>
+template <typename... Args>
+inline RadixHeap<T, KeyOf>& RadixHeap<T, KeyOf>::emplace(Args&&... args)
+{
+    T val(std::forward<Args>(args)...);
+
+    Key key = KeyOf::get(val);
+    if (key < last) throw std::invalid_argument("RadixHeap key is below the last popped key");
+
+    std::size_t idx = bucketOf(key);
+    insert(idx, std::move(val));
+
+    if (count == 0 || idx < topBucket) topBucket = idx;
+
+    count++;
+
+    return *this;
+}
+
+template <typename T, typename KeyOf>
+inline RadixHeap<T, KeyOf>& RadixHeap<T, KeyOf>::pop()
+{
+    if (empty()) return *this;
+
+    refill();
+
+    buckets[0].pop_back();
+    count--;
+
+    locateTop();
+
+    return *this;
+}
+
+template <typename T, typename KeyOf>
+inline RadixHeap<T, KeyOf>& RadixHeap<T, KeyOf>::pop(T& out)
+{
+    if (empty()) return *this;
+
+    refill();
+
+    out = std::move(buckets[0].back());
+    buckets[0].pop_back();
+    count--;
+
+    locateTop();
+
+    return *this;
+}
+
+template <typename T, typename KeyOf>
+inline const T& RadixHeap<T, KeyOf>::top() const
+{
+    const std::vector<T>& bucket = buckets[topBucket];
+    return topBucket == 0 ? bucket.back() : bucket[minimum[topBucket]];
+}
+
+template <typename T, typename KeyOf>
+inline RadixHeap<T, KeyOf>& RadixHeap<T, KeyOf>::clear()
+{
+    for (std::vector<T>& bucket : buckets)
+    {
+        bucket.clear();
+    }
+
+    last = 0;
+    count = 0;
+
+    topBucket = 0;
+
+    return *this;
+}
+
+template <typename T, typename KeyOf>
+inline std::size_t RadixHeap<T, KeyOf>::bucketOf(Key key) const
+{
+    return key == last ? 0 : Bits::log2Floor(static_cast<std::size_t>(key ^ last)) + 1;
+}
+
+template <typename T, typename KeyOf>
+inline void RadixHeap<T, KeyOf>::insert(std::size_t idx, T&& val)
+{
+    std::vector<T>& bucket = buckets[idx];
+    bucket.push_back(std::move(val));
+
+    if (bucket.size() == 1 || KeyOf::get(bucket.back()) < KeyOf::get(bucket[minimum[idx]]))
+    {
+        minimum[idx] = bucket.size() - 1;
+    }
+}
+
+template <typename T, typename KeyOf>
+void RadixHeap<T, KeyOf>::refill()
+{
+    if (!buckets[0].empty()) return;
+
+    std::vector<T>& source = buckets[topBucket];
+    last = KeyOf::get(source[minimum[topBucket]]);
+
+    for (T& val : source)
+    {
+        insert(bucketOf(KeyOf::get(val)), std::move(val));
+    }
+
+    source.clear();
+    topBucket = 0;
+}
+
+template <typename T, typename KeyOf>
+void RadixHeap<T, KeyOf>::locateTop()
+{
+    if (empty()) return;
+
+    topBucket = 0;
+    while (buckets[topBucket].empty()) topBucket++;
+}
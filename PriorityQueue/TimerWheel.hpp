@@ -0,0 +1,306 @@
+#pragma once
+
+#include <iostream>
+
+#include <utility>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <limits>
+
+#include "../Utility/Bits.hpp"
+
+class TimerNode
+{
+private:
+    TimerNode* prev;
+    TimerNode* next;
+
+    std::uint64_t deadline;
+    std::size_t slot;
+
+    friend class TimerWheel;
+
+public:
+    TimerNode();
+
+    bool isScheduled() const;
+    std::uint64_t getDeadline() const;
+
+    TimerNode(const TimerNode& other);
+    TimerNode& operator=(const TimerNode& other);
+};
+
+class TimerWheel
+{
+private:
+    static constexpr std::size_t LEVEL_BITS = 6;
+    static constexpr std::size_t SLOTS = std::size_t(1) << LEVEL_BITS;
+    static constexpr std::size_t TIME_BITS = sizeof(std::uint64_t) * CHAR_BIT;
+    static constexpr std::size_t LEVELS = (TIME_BITS + LEVEL_BITS - 1) / LEVEL_BITS;
+    static constexpr std::size_t OVERDUE = LEVELS * SLOTS;
+    static constexpr std::uint64_t NEVER = std::numeric_limits<std::uint64_t>::max();
+
+    TimerNode slots[LEVELS * SLOTS + 1];
+    std::uint64_t occupied[LEVELS];
+
+    std::uint64_t now;
+    std::size_t size;
+
+public:
+    explicit TimerWheel(std::uint64_t start = 0);
+
+    std::size_t getSize() const;
+    std::uint64_t getTime() const;
+
+    bool isEmpty() const;
+
+    TimerWheel& schedule(TimerNode& node, std::uint64_t deadline);
+    TimerWheel& cancel(TimerNode& node);
+
+    template <typename F>
+    std::size_t advance(std::uint64_t target, F&& expire);
+
+    TimerWheel(const TimerWheel& other) = delete;
+    TimerWheel& operator=(const TimerWheel& other) = delete;
+
+    ~TimerWheel() noexcept;
+
+private:
+    static std::size_t slotOf(std::uint64_t time, std::size_t level);
+    static std::uint64_t blockStart(std::uint64_t time, std::size_t level);
+
+    void link(TimerNode& node, std::size_t slot);
+    void unlink(TimerNode& node);
+
+    void place(TimerNode& node);
+    void cascade(std::size_t level);
+
+    std::uint64_t nextEvent() const;
+
+    template <typename F>
+    std::size_t expireSlot(std::size_t slot, F& expire);
+};
+
+inline TimerNode::TimerNode() : prev(nullptr), next(nullptr), deadline(0), slot(0)
+{
+}
+
+inline bool TimerNode::isScheduled() const
+{
+    return next != nullptr;
+}
+
+inline std::uint64_t TimerNode::getDeadline() const
+{
+    return deadline;
+}
+
+inline TimerNode::TimerNode(const TimerNode& other) : prev(nullptr), next(nullptr), deadline(other.deadline), slot(0)
+{
+}
+
+inline TimerNode& TimerNode::operator=(const TimerNode&)
+{
+    return *this;
+}
+
+inline TimerWheel::TimerWheel(std::uint64_t start) : occupied(), now(start), size(0)
+{
+    for (TimerNode& sentinel : slots)
+    {
+        sentinel.prev = sentinel.next = &sentinel;
+    }
+}
+
+inline std::size_t TimerWheel::getSize() const
+{
+    return size;
+}
+
+inline std::uint64_t TimerWheel::getTime() const
+{
+    return now;
+}
+
+inline bool TimerWheel::isEmpty() const
+{
+    return size == 0;
+}
+
+inline TimerWheel& TimerWheel::schedule(TimerNode& node, std::uint64_t deadline)
+{
+    if (node.isScheduled()) unlink(node);
+    else size++;
+
+    node.deadline = deadline;
+
+    if (deadline <= now) link(node, OVERDUE);
+    else place(node);
+
+    return *this;
+}
+
+inline TimerWheel& TimerWheel::cancel(TimerNode& node)
+{
+    if (!node.isScheduled()) return *this;
+
+    unlink(node);
+    size--;
+
+    return *this;
+}
+
+template <typename F>
+std::size_t TimerWheel::advance(std::uint64_t target, F&& expire)
+{
+    std::size_t expired = expireSlot(OVERDUE, expire);
+
+    while (now < target)
+    {
+        std::uint64_t next = nextEvent();
+
+        if (next > target)
+        {
+            now = target;
+            break;
+        }
+
+        now = next;
+
+        for (std::size_t level = LEVELS - 1; level > 0; level--)
+        {
+            if (blockStart(now, level) == now) cascade(level);
+        }
+
+        expired += expireSlot(slotOf(now, 0), expire);
+    }
+
+    return expired;
+}
+
+inline TimerWheel::~TimerWheel() noexcept
+{
+    for (TimerNode& sentinel : slots)
+    {
+        while (sentinel.next != &sentinel)
+        {
+            TimerNode* node = sentinel.next;
+
+            sentinel.next = node->next;
+            node->prev = node->next = nullptr;
+        }
+    }
+}
+
+inline std::size_t TimerWheel::slotOf(std::uint64_t time, std::size_t level)
+{
+    return static_cast<std::size_t>(time >> (level * LEVEL_BITS)) & (SLOTS - 1);
+}
+
+inline std::uint64_t TimerWheel::blockStart(std::uint64_t time, std::size_t level)
+{
+    std::size_t shift = level * LEVEL_BITS;
+    return shift >= TIME_BITS ? 0 : (time >> shift) << shift;
+}
+
+inline void TimerWheel::link(TimerNode& node, std::size_t slot)
+{
+    TimerNode& sentinel = slots[slot];
+
+    node.slot = slot;
+    node.prev = sentinel.prev;
+    node.next = &sentinel;
+
+    sentinel.prev->next = &node;
+    sentinel.prev = &node;
+
+    if (slot != OVERDUE) occupied[slot / SLOTS] |= std::uint64_t(1) << (slot % SLOTS);
+}
+
+inline void TimerWheel::unlink(TimerNode& node)
+{
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+
+    node.prev = node.next = nullptr;
+
+    TimerNode& sentinel = slots[node.slot];
+    if (node.slot != OVERDUE && sentinel.next == &sentinel)
+    {
+        occupied[node.slot / SLOTS] &= ~(std::uint64_t(1) << (node.slot % SLOTS));
+    }
+}
+
+inline void TimerWheel::place(TimerNode& node)
+{
+    std::uint64_t diff = node.deadline ^ now;
+    std::size_t level = diff ? Bits::log2Floor(static_cast<std::size_t>(diff)) / LEVEL_BITS : 0;
+
+    link(node, level * SLOTS + slotOf(node.deadline, level));
+}
+
+inline void TimerWheel::cascade(std::size_t level)
+{
+    TimerNode& sentinel = slots[level * SLOTS + slotOf(now, level)];
+
+    while (sentinel.next != &sentinel)
+    {
+        TimerNode& node = *sentinel.next;
+
+        unlink(node);
+        place(node);
+    }
+}
+
+inline std::uint64_t TimerWheel::nextEvent() const
+{
+    std::uint64_t next = NEVER;
+
+    for (std::size_t level = 0; level < LEVELS; level++)
+    {
+        std::size_t current = slotOf(now, level);
+        std::uint64_t pending = current + 1 < SLOTS ? occupied[level] & (~std::uint64_t(0) << (current + 1)) : 0;
+
+        if (!pending) continue;
+
+        std::uint64_t slot = static_cast<std::uint64_t>(Bits::log2Floor(static_cast<std::size_t>(pending & (~pending + 1))));
+        next = std::min(next, blockStart(now, level + 1) + (slot << (level * LEVEL_BITS)));
+    }
+
+    return next;
+}
+
+template <typename F>
+std::size_t TimerWheel::expireSlot(std::size_t slot, F& expire)
+{
+    TimerNode& sentinel = slots[slot];
+    if (sentinel.next == &sentinel) return 0;
+
+    TimerNode batch;
+    batch.prev = sentinel.prev;
+    batch.next = sentinel.next;
+    batch.prev->next = &batch;
+    batch.next->prev = &batch;
+
+    sentinel.prev = sentinel.next = &sentinel;
+    if (slot != OVERDUE) occupied[slot / SLOTS] &= ~(std::uint64_t(1) << (slot % SLOTS));
+
+    std::size_t expired = 0;
+
+    while (batch.next != &batch)
+    {
+        TimerNode& node = *batch.next;
+
+        node.prev->next = node.next;
+        node.next->prev = node.prev;
+        node.prev = node.next = nullptr;
+
+        size--;
+        expired++;
+
+        expire(node);
+    }
+
+    return expired;
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <iostream>
+
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <vector>
+
+#include "PriorityQueue.hpp"
+
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 2>
+class TopK
+{
+private:
+    struct Inverted
+    {
+        Compare compare;
+
+        bool operator()(const T& lhs, const T& rhs) const
+        {
+            return compare(rhs, lhs);
+        }
+    };
+
+    PriorityQueue<T, std::vector<T>, Inverted, Arity> heap;
+    std::size_t limit;
+
+    Compare compare;
+
+public:
+    explicit TopK(std::size_t k, const Compare& compare = Compare());
+
+    std::size_t size() const;
+    std::size_t capacity() const;
+
+    bool empty() const;
+    bool full() const;
+
+    bool offer(const T& val);
+    bool offer(T&& val);
+
+    template <typename InputIt>
+    std::size_t offer(InputIt first, InputIt last);
+
+    const T& worst() const;
+
+    std::vector<T> drain();
+
+    TopK<T, Compare, Arity>& clear();
+
+private:
+    bool rejects(const T& val) const;
+};
+
+template <typename T, typename Compare, std::size_t Arity>
+TopK<T, Compare, Arity>::TopK(std::size_t k, const Compare& compare) : heap(Inverted{ compare }), limit(k), compare(compare)
+{
+    heap.reserve(k);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t TopK<T, Compare, Arity>::size() const
+{
+    return heap.size();
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline std::size_t TopK<T, Compare, Arity>::capacity() const
+{
+    return limit;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool TopK<T, Compare, Arity>::empty() const
+{
+    return heap.empty();
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool TopK<T, Compare, Arity>::full() const
+{
+    return heap.size() >= limit;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool TopK<T, Compare, Arity>::offer(const T& val)
+{
+    if (!full())
+    {
+        heap.push(val);
+        return true;
+    }
+
+    if (rejects(val)) return false;
+
+    heap.replace_top(val);
+    return true;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool TopK<T, Compare, Arity>::offer(T&& val)
+{
+    if (!full())
+    {
+        heap.push(std::move(val));
+        return true;
+    }
+
+    if (rejects(val)) return false;
+
+    heap.replace_top(std::move(val));
+    return true;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename InputIt>
+std::size_t TopK<T, Compare, Arity>::offer(InputIt first, InputIt last)
+{
+    std::size_t kept = 0;
+
+    if constexpr (std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value)
+    {
+        std::size_t room = limit - std::min(limit, heap.size());
+        std::size_t available = static_cast<std::size_t>(std::distance(first, last));
+
+        std::size_t taken = std::min(room, available);
+
+        if (taken)
+        {
+            InputIt middle = std::next(first, static_cast<typename std::iterator_traits<InputIt>::difference_type>(taken));
+
+            heap.push_range(first, middle);
+            kept += taken;
+
+            first = middle;
+        }
+    }
+
+    for (; first != last && !full(); ++first, kept++)
+    {
+        heap.push(*first);
+    }
+
+    if (limit == 0) return kept;
+
+    for (; first != last; ++first)
+    {
+        if (rejects(*first)) continue;
+
+        heap.replace_top(*first);
+        kept++;
+    }
+
+    return kept;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline const T& TopK<T, Compare, Arity>::worst() const
+{
+    return heap.top();
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+std::vector<T> TopK<T, Compare, Arity>::drain()
+{
+    std::vector<T> result(heap.size());
+
+    for (std::size_t i = result.size(); i-- > 0;)
+    {
+        heap.pop(result[i]);
+    }
+
+    return result;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline TopK<T, Compare, Arity>& TopK<T, Compare, Arity>::clear()
+{
+    while (!heap.empty()) heap.pop();
+    return *this;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+inline bool TopK<T, Compare, Arity>::rejects(const T& val) const
+{
+    return limit == 0 || !compare(heap.top(), val);
+}
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "Queue.hpp"
+
+template <typename T, typename Allocator = std::allocator<T>>
+class BlockingQueue
+{
+private:
+    Queue<T, Allocator> queue;
+
+    mutable std::mutex mutex;
+    std::condition_variable notEmpty;
+
+    std::size_t waiting;
+    std::size_t signalled;
+    bool closed;
+
+public:
+    BlockingQueue();
+
+    std::size_t getSize() const;
+
+    bool isEmpty() const;
+    bool isClosed() const;
+
+    bool push(const T& val);
+    bool push(T&& val);
+
+    template <typename InputIt>
+    std::size_t push_range(InputIt first, InputIt last);
+
+    bool pop(T& out);
+    bool try_pop(T& out);
+
+    template <typename Rep, typename Period>
+    bool pop_for(T& out, const std::chrono::duration<Rep, Period>& timeout);
+
+    template <typename Clock, typename Duration>
+    bool pop_until(T& out, const std::chrono::time_point<Clock, Duration>& deadline);
+
+    template <typename OutputIt>
+    std::size_t pop_all(OutputIt out);
+
+    template <typename OutputIt>
+    std::size_t drain(OutputIt out, std::size_t max);
+
+    BlockingQueue<T, Allocator>& close();
+
+    BlockingQueue(const BlockingQueue<T, Allocator>& other) = delete;
+    BlockingQueue<T, Allocator>& operator=(const BlockingQueue<T, Allocator>& other) = delete;
+
+private:
+    template <typename OutputIt>
+    std::size_t take(OutputIt& out, std::size_t max);
+
+    void await(std::unique_lock<std::mutex>& lock);
+
+    template <typename Clock, typename Duration>
+    void await_until(std::unique_lock<std::mutex>& lock, const std::chrono::time_point<Clock, Duration>& deadline);
+
+    std::size_t signal(std::size_t added);
+    void notify(std::size_t wakeups);
+};
+
+template <typename T, typename Allocator>
+BlockingQueue<T, Allocator>::BlockingQueue() : waiting(0), signalled(0), closed(false)
+{
+}
+
+template <typename T, typename Allocator>
+inline std::size_t BlockingQueue<T, Allocator>::getSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.getSize();
+}
+
+template <typename T, typename Allocator>
+inline bool BlockingQueue<T, Allocator>::isEmpty() const
+{
+    return getSize() == 0;
+}
+
+template <typename T, typename Allocator>
+inline bool BlockingQueue<T, Allocator>::isClosed() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+}
+
+template <typename T, typename Allocator>
+inline bool BlockingQueue<T, Allocator>::push(const T& val)
+{
+    std::size_t wakeups;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) return false;
+
+        queue.push(val);
+        wakeups = signal(1);
+    }
+
+    notify(wakeups);
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline bool BlockingQueue<T, Allocator>::push(T&& val)
+{
+    std::size_t wakeups;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) return false;
+
+        queue.push(std::move(val));
+        wakeups = signal(1);
+    }
+
+    notify(wakeups);
+    return true;
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+std::size_t BlockingQueue<T, Allocator>::push_range(InputIt first, InputIt last)
+{
+    std::size_t added = 0;
+    std::size_t wakeups;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) return 0;
+
+        if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value)
+        {
+            queue.reserve(queue.getSize() + static_cast<std::size_t>(std::distance(first, last)));
+        }
+
+        for (; first != last; ++first, added++)
+        {
+            queue.push(*first);
+        }
+
+        wakeups = signal(added);
+    }
+
+    notify(wakeups);
+    return added;
+}
+
+template <typename T, typename Allocator>
+bool BlockingQueue<T, Allocator>::pop(T& out)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    await(lock);
+
+    T* dst = &out;
+    return take(dst, 1) == 1;
+}
+
+template <typename T, typename Allocator>
+inline bool BlockingQueue<T, Allocator>::try_pop(T& out)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    T* dst = &out;
+    return take(dst, 1) == 1;
+}
+
+template <typename T, typename Allocator>
+template <typename Rep, typename Period>
+inline bool BlockingQueue<T, Allocator>::pop_for(T& out, const std::chrono::duration<Rep, Period>& timeout)
+{
+    return pop_until(out, std::chrono::steady_clock::now() + timeout);
+}
+
+template <typename T, typename Allocator>
+template <typename Clock, typename Duration>
+bool BlockingQueue<T, Allocator>::pop_until(T& out, const std::chrono::time_point<Clock, Duration>& deadline)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    await_until(lock, deadline);
+
+    T* dst = &out;
+    return take(dst, 1) == 1;
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+inline std::size_t BlockingQueue<T, Allocator>::pop_all(OutputIt out)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return take(out, queue.getSize());
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+std::size_t BlockingQueue<T, Allocator>::drain(OutputIt out, std::size_t max)
+{
+    if (max == 0) return 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    await(lock);
+
+    return take(out, max);
+}
+
+template <typename T, typename Allocator>
+BlockingQueue<T, Allocator>& BlockingQueue<T, Allocator>::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        closed = true;
+        signalled = waiting;
+    }
+
+    notEmpty.notify_all();
+    return *this;
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+inline std::size_t BlockingQueue<T, Allocator>::take(OutputIt& out, std::size_t max)
+{
+    std::size_t taken = 0;
+
+    for (; taken < max && !queue.isEmpty(); taken++)
+    {
+        *out = std::move(queue.front());
+        ++out;
+
+        queue.pop();
+    }
+
+    return taken;
+}
+
+template <typename T, typename Allocator>
+void BlockingQueue<T, Allocator>::await(std::unique_lock<std::mutex>& lock)
+{
+    waiting++;
+
+    while (queue.isEmpty() && !closed)
+    {
+        notEmpty.wait(lock);
+        if (signalled) signalled--;
+    }
+
+    waiting--;
+}
+
+template <typename T, typename Allocator>
+template <typename Clock, typename Duration>
+void BlockingQueue<T, Allocator>::await_until(std::unique_lock<std::mutex>& lock, const std::chrono::time_point<Clock, Duration>& deadline)
+{
+    waiting++;
+
+    while (queue.isEmpty() && !closed)
+    {
+        std::cv_status status = notEmpty.wait_until(lock, deadline);
+        if (signalled) signalled--;
+
+        if (status == std::cv_status::timeout) break;
+    }
+
+    waiting--;
+}
+
+template <typename T, typename Allocator>
+inline std::size_t BlockingQueue<T, Allocator>::signal(std::size_t added)
+{
+    std::size_t wakeups = std::min(added, waiting - signalled);
+
+    signalled += wakeups;
+    return wakeups;
+}
+
+template <typename T, typename Allocator>
+inline void BlockingQueue<T, Allocator>::notify(std::size_t wakeups)
+{
+    for (; wakeups > 0; wakeups--)
+    {
+        notEmpty.notify_one();
+    }
+}
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "../Utility/Bits.hpp"
+#include "../Utility/Hardware.hpp"
+
+template <typename T, typename Allocator = std::allocator<T>>
+class MPMCQueue
+{
+private:
+    static constexpr std::size_t DEFAULT_SPIN_COUNT = 256;
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value()
+        {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    using CellAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+
+    Cell* cells;
+    std::size_t capacity;
+    std::size_t mask;
+    std::size_t spinCount;
+
+    Allocator allocator;
+    CellAllocator cellAllocator;
+    using AllocatorT = std::allocator_traits<Allocator>;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::size_t> put;
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::size_t> get;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::size_t> waitingProducers;
+    std::atomic<std::size_t> waitingConsumers;
+
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+
+public:
+    explicit MPMCQueue(std::size_t n, std::size_t spinCount = DEFAULT_SPIN_COUNT);
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+
+    bool try_push(const T& val);
+    bool try_push(T&& val);
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_pop(T& out);
+
+    MPMCQueue<T, Allocator>& push(const T& val);
+    MPMCQueue<T, Allocator>& push(T&& val);
+
+    template <typename... Args>
+    MPMCQueue<T, Allocator>& emplace(Args&&... args);
+
+    MPMCQueue<T, Allocator>& pop(T& out);
+
+    MPMCQueue(const MPMCQueue<T, Allocator>& other) = delete;
+    MPMCQueue<T, Allocator>& operator=(const MPMCQueue<T, Allocator>& other) = delete;
+
+    ~MPMCQueue() noexcept;
+
+private:
+    template <typename... Args>
+    bool enqueue(Args&&... args);
+    bool dequeue(T& out);
+
+    void wake(std::atomic<std::size_t>& waiting, std::condition_variable& condition);
+};
+
+template <typename T, typename Allocator>
+MPMCQueue<T, Allocator>::MPMCQueue(std::size_t n, std::size_t spinCount)
+    :   cells(nullptr),
+        capacity(Bits::nextPowerOfTwo(std::max<std::size_t>(n, 2))),
+        mask(capacity - 1),
+        spinCount(spinCount),
+        put(0),
+        get(0),
+        waitingProducers(0),
+        waitingConsumers(0)
+{
+    cells = cellAllocator.allocate(capacity);
+
+    for (std::size_t i = 0; i < capacity; i++)
+    {
+        ::new (static_cast<void*>(&cells[i].sequence)) std::atomic<std::size_t>(i);
+    }
+}
+
+template <typename T, typename Allocator>
+inline std::size_t MPMCQueue<T, Allocator>::getSize() const
+{
+    std::size_t head = get.load(std::memory_order_acquire);
+    std::size_t tail = put.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+template <typename T, typename Allocator>
+inline std::size_t MPMCQueue<T, Allocator>::getCapacity() const
+{
+    return capacity;
+}
+
+template <typename T, typename Allocator>
+inline bool MPMCQueue<T, Allocator>::isEmpty() const
+{
+    return getSize() == 0;
+}
+
+template <typename T, typename Allocator>
+inline bool MPMCQueue<T, Allocator>::try_push(const T& val)
+{
+    return try_emplace(val);
+}
+
+template <typename T, typename Allocator>
+inline bool MPMCQueue<T, Allocator>::try_push(T&& val)
+{
+    return try_emplace(std::move(val));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline bool MPMCQueue<T, Allocator>::try_emplace(Args&&... args)
+{
+    if (!enqueue(std::forward<Args>(args)...)) return false;
+
+    wake(waitingConsumers, notEmpty);
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline bool MPMCQueue<T, Allocator>::try_pop(T& out)
+{
+    if (!dequeue(out)) return false;
+
+    wake(waitingProducers, notFull);
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline MPMCQueue<T, Allocator>& MPMCQueue<T, Allocator>::push(const T& val)
+{
+    return emplace(val);
+}
+
+template <typename T, typename Allocator>
+inline MPMCQueue<T, Allocator>& MPMCQueue<T, Allocator>::push(T&& val)
+{
+    return emplace(std::move(val));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+MPMCQueue<T, Allocator>& MPMCQueue<T, Allocator>::emplace(Args&&... args)
+{
+    for (std::size_t i = 0; i < spinCount; i++)
+    {
+        if (try_emplace(std::forward<Args>(args)...)) return *this;
+        Hardware::pause();
+    }
+
+    waitingProducers.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!enqueue(std::forward<Args>(args)...)) notFull.wait(lock);
+    }
+
+    waitingProducers.fetch_sub(1);
+
+    wake(waitingConsumers, notEmpty);
+    return *this;
+}
+
+template <typename T, typename Allocator>
+MPMCQueue<T, Allocator>& MPMCQueue<T, Allocator>::pop(T& out)
+{
+    for (std::size_t i = 0; i < spinCount; i++)
+    {
+        if (try_pop(out)) return *this;
+        Hardware::pause();
+    }
+
+    waitingConsumers.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!dequeue(out)) notEmpty.wait(lock);
+    }
+
+    waitingConsumers.fetch_sub(1);
+
+    wake(waitingProducers, notFull);
+    return *this;
+}
+
+template <typename T, typename Allocator>
+MPMCQueue<T, Allocator>::~MPMCQueue() noexcept
+{
+    std::size_t end = put.load(std::memory_order_acquire);
+
+    for (std::size_t pos = get.load(std::memory_order_acquire); pos != end; pos++)
+    {
+        AllocatorT::destroy(allocator, cells[pos & mask].value());
+    }
+
+    for (std::size_t i = 0; i < capacity; i++)
+    {
+        cells[i].sequence.~atomic();
+    }
+
+    cellAllocator.deallocate(cells, capacity);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline bool MPMCQueue<T, Allocator>::enqueue(Args&&... args)
+{
+    std::size_t pos = put.load(std::memory_order_relaxed);
+    Cell* cell;
+
+    while (true)
+    {
+        cell = &cells[pos & mask];
+
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - pos);
+
+        if (diff == 0)
+        {
+            if (put.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = put.load(std::memory_order_relaxed);
+        }
+    }
+
+    AllocatorT::construct(allocator, cell->value(), std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline bool MPMCQueue<T, Allocator>::dequeue(T& out)
+{
+    std::size_t pos = get.load(std::memory_order_relaxed);
+    Cell* cell;
+
+    while (true)
+    {
+        cell = &cells[pos & mask];
+
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+
+        if (diff == 0)
+        {
+            if (get.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = get.load(std::memory_order_relaxed);
+        }
+    }
+
+    out = std::move(*cell->value());
+    AllocatorT::destroy(allocator, cell->value());
+
+    cell->sequence.store(pos + capacity, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline void MPMCQueue<T, Allocator>::wake(std::atomic<std::size_t>& waiting, std::condition_variable& condition)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (waiting.load(std::memory_order_relaxed) == 0) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+
+    condition.notify_all();
+}
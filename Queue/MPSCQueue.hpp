@@ -0,0 +1,273 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "../Utility/Bits.hpp"
+#include "../Utility/Hardware.hpp"
+
+template <typename T, typename Allocator = std::allocator<T>>
+class MPSCQueue
+{
+private:
+    static constexpr std::size_t FIRST_CHUNK_SHIFT = 6;
+    static constexpr std::size_t FIRST_CHUNK_SIZE = std::size_t(1) << FIRST_CHUNK_SHIFT;
+    static constexpr std::size_t MAX_CHUNKS = 32 - FIRST_CHUNK_SHIFT;
+
+    struct Node
+    {
+        std::atomic<Node*> next;
+        std::atomic<std::uint32_t> poolNext;
+        std::uint32_t index;
+
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value()
+        {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<Node*> tail;
+    alignas(Hardware::CACHE_LINE_SIZE) Node* head;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::uint64_t> pool;
+    std::atomic<std::uint32_t> allocated;
+
+    std::atomic<Node*> chunks[MAX_CHUNKS];
+    std::mutex chunkMutex;
+
+    Allocator allocator;
+    NodeAllocator nodeAllocator;
+    using AllocatorT = std::allocator_traits<Allocator>;
+
+public:
+    MPSCQueue();
+
+    bool isEmpty() const;
+
+    MPSCQueue<T, Allocator>& push(const T& val);
+    MPSCQueue<T, Allocator>& push(T&& val);
+
+    template <typename... Args>
+    MPSCQueue<T, Allocator>& emplace(Args&&... args);
+
+    T* front();
+
+    bool pop();
+    bool try_pop(T& out);
+
+    MPSCQueue<T, Allocator>& reserve(std::size_t n);
+
+    MPSCQueue(const MPSCQueue<T, Allocator>& other) = delete;
+    MPSCQueue<T, Allocator>& operator=(const MPSCQueue<T, Allocator>& other) = delete;
+
+    ~MPSCQueue() noexcept;
+
+private:
+    Node* node(std::uint32_t index);
+
+    Node* acquireNode();
+    Node* createNode();
+    void releaseNode(Node* released);
+};
+
+template <typename T, typename Allocator>
+MPSCQueue<T, Allocator>::MPSCQueue() : tail(nullptr), head(nullptr), pool(0), allocated(0), chunks()
+{
+    head = createNode();
+    head->next.store(nullptr, std::memory_order_relaxed);
+    tail.store(head, std::memory_order_relaxed);
+}
+
+template <typename T, typename Allocator>
+inline bool MPSCQueue<T, Allocator>::isEmpty() const
+{
+    return head->next.load(std::memory_order_acquire) == nullptr;
+}
+
+template <typename T, typename Allocator>
+inline MPSCQueue<T, Allocator>& MPSCQueue<T, Allocator>::push(const T& val)
+{
+    return emplace(val);
+}
+
+template <typename T, typename Allocator>
+inline MPSCQueue<T, Allocator>& MPSCQueue<T, Allocator>::push(T&& val)
+{
+    return emplace(std::move(val));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline MPSCQueue<T, Allocator>& MPSCQueue<T, Allocator>::emplace(Args&&... args)
+{
+    Node* added = acquireNode();
+
+    try
+    {
+        AllocatorT::construct(allocator, added->value(), std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        releaseNode(added);
+        throw;
+    }
+
+    added->next.store(nullptr, std::memory_order_relaxed);
+
+    Node* prev = tail.exchange(added, std::memory_order_acq_rel);
+    prev->next.store(added, std::memory_order_release);
+
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline T* MPSCQueue<T, Allocator>::front()
+{
+    Node* next = head->next.load(std::memory_order_acquire);
+    return next ? next->value() : nullptr;
+}
+
+template <typename T, typename Allocator>
+inline bool MPSCQueue<T, Allocator>::pop()
+{
+    Node* next = head->next.load(std::memory_order_acquire);
+    if (!next) return false;
+
+    AllocatorT::destroy(allocator, next->value());
+
+    releaseNode(std::exchange(head, next));
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline bool MPSCQueue<T, Allocator>::try_pop(T& out)
+{
+    Node* next = head->next.load(std::memory_order_acquire);
+    if (!next) return false;
+
+    out = std::move(*next->value());
+    AllocatorT::destroy(allocator, next->value());
+
+    releaseNode(std::exchange(head, next));
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline MPSCQueue<T, Allocator>& MPSCQueue<T, Allocator>::reserve(std::size_t n)
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        releaseNode(createNode());
+    }
+
+    return *this;
+}
+
+template <typename T, typename Allocator>
+MPSCQueue<T, Allocator>::~MPSCQueue() noexcept
+{
+    while (pop());
+
+    for (std::size_t k = 0; k < MAX_CHUNKS; k++)
+    {
+        Node* chunk = chunks[k].load(std::memory_order_relaxed);
+        if (!chunk) continue;
+
+        std::size_t chunkSize = FIRST_CHUNK_SIZE << k;
+
+        for (std::size_t i = 0; i < chunkSize; i++)
+        {
+            chunk[i].~Node();
+        }
+
+        nodeAllocator.deallocate(chunk, chunkSize);
+    }
+}
+
+template <typename T, typename Allocator>
+inline typename MPSCQueue<T, Allocator>::Node* MPSCQueue<T, Allocator>::node(std::uint32_t index)
+{
+    std::size_t shifted = std::size_t(index) + FIRST_CHUNK_SIZE;
+    std::size_t chunk = Bits::log2Floor(shifted) - FIRST_CHUNK_SHIFT;
+
+    return chunks[chunk].load(std::memory_order_acquire) + (shifted & ((FIRST_CHUNK_SIZE << chunk) - 1));
+}
+
+template <typename T, typename Allocator>
+inline typename MPSCQueue<T, Allocator>::Node* MPSCQueue<T, Allocator>::acquireNode()
+{
+    std::uint64_t top = pool.load(std::memory_order_acquire);
+
+    while (static_cast<std::uint32_t>(top) != 0)
+    {
+        Node* taken = node(static_cast<std::uint32_t>(top) - 1);
+
+        std::uint64_t tag = (top >> 32) + 1;
+        std::uint64_t next = (tag << 32) | taken->poolNext.load(std::memory_order_relaxed);
+
+        if (pool.compare_exchange_weak(top, next, std::memory_order_acquire, std::memory_order_acquire)) return taken;
+    }
+
+    return createNode();
+}
+
+template <typename T, typename Allocator>
+typename MPSCQueue<T, Allocator>::Node* MPSCQueue<T, Allocator>::createNode()
+{
+    std::uint32_t index = allocated.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t shifted = std::size_t(index) + FIRST_CHUNK_SIZE;
+    std::size_t chunk = Bits::log2Floor(shifted) - FIRST_CHUNK_SHIFT;
+
+    if (chunk >= MAX_CHUNKS) throw std::bad_alloc();
+
+    if (!chunks[chunk].load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(chunkMutex);
+
+        if (!chunks[chunk].load(std::memory_order_relaxed))
+        {
+            std::size_t chunkSize = FIRST_CHUNK_SIZE << chunk;
+            std::size_t first = chunkSize - FIRST_CHUNK_SIZE;
+
+            Node* nodes = nodeAllocator.allocate(chunkSize);
+
+            for (std::size_t i = 0; i < chunkSize; i++)
+            {
+                Node* created = ::new (static_cast<void*>(&nodes[i])) Node;
+
+                created->next.store(nullptr, std::memory_order_relaxed);
+                created->poolNext.store(0, std::memory_order_relaxed);
+                created->index = static_cast<std::uint32_t>(first + i);
+            }
+
+            chunks[chunk].store(nodes, std::memory_order_release);
+        }
+    }
+
+    return node(index);
+}
+
+template <typename T, typename Allocator>
+inline void MPSCQueue<T, Allocator>::releaseNode(Node* released)
+{
+    std::uint64_t top = pool.load(std::memory_order_relaxed);
+    std::uint64_t next;
+
+    do
+    {
+        released->poolNext.store(static_cast<std::uint32_t>(top), std::memory_order_relaxed);
+
+        std::uint64_t tag = (top >> 32) + 1;
+        next = (tag << 32) | (std::uint64_t(released->index) + 1);
+    }
+    while (!pool.compare_exchange_weak(top, next, std::memory_order_release, std::memory_order_relaxed));
+}
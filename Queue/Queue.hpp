@@ -3,6 +3,13 @@
 #include <iostream>
 #include <memory>
 #include <utility>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include "../Utility/Bits.hpp"
+#include "../Utility/Hardware.hpp"
 
 namespace Constants
 {
@@ -37,6 +44,10 @@ public:
     Queue<T, Allocator>& pop();
 
     const T& front() const;
+    T& front();
+
+    Queue<T, Allocator>& reserve(std::size_t n);
+    Queue<T, Allocator>& shrink_to_fit();
 
     Queue(const Queue<T, Allocator>& other);
     Queue<T, Allocator>& operator=(const Queue<T, Allocator>& other);
@@ -50,6 +61,8 @@ private:
     void resize(std::size_t n);
     std::size_t calculateCapacity() const;
 
+    void relocate(T* dst);
+
     void copyFrom(const Queue<T, Allocator>& other);
     void moveFrom(Queue<T, Allocator>&& other) noexcept;
     void free() noexcept;
@@ -83,7 +96,7 @@ inline Queue<T, Allocator>& Queue<T, Allocator>::push(const T& val)
 {
     if (size >= capacity) resize(calculateCapacity());
 
-    data[put] = val;
+    AllocatorT::construct(allocator, &data[put], val);
     (++put) %= capacity;
 
     size++;
@@ -95,7 +108,7 @@ inline Queue<T, Allocator>& Queue<T, Allocator>::push(T&& val)
 {
     if (size >= capacity) resize(calculateCapacity());
 
-    data[put] = std::move(val);
+    AllocatorT::construct(allocator, &data[put], std::move(val));
     (++put) %= capacity;
 
     size++;
@@ -120,6 +133,28 @@ const T& Queue<T, Allocator>::front() const
     return data[get];
 }
 
+template <typename T, typename Allocator>
+T& Queue<T, Allocator>::front()
+{
+    return data[get];
+}
+
+template <typename T, typename Allocator>
+inline Queue<T, Allocator>& Queue<T, Allocator>::reserve(std::size_t n)
+{
+    if (n > capacity) resize(n);
+    return *this;
+}
+
+template <typename T, typename Allocator>
+Queue<T, Allocator>& Queue<T, Allocator>::shrink_to_fit()
+{
+    if (size == 0) free();
+    else if (size < capacity) resize(size);
+
+    return *this;
+}
+
 template <typename T, typename Allocator>
 Queue<T, Allocator>::Queue(const Queue<T, Allocator>& other)
 {
@@ -167,18 +202,14 @@ inline void Queue<T, Allocator>::resize(std::size_t n)
 {
     T* newData = allocator.allocate(n);
 
-    for (std::size_t i = 0; i < size; i++)
-    {
-        AllocatorT::construct(allocator, &newData[i], std::move(data[get]));
-        (++get) %= capacity;
-    }
+    relocate(newData);
+
+    if (data) allocator.deallocate(data, capacity);
 
-    allocator.deallocate(data, capacity);
-    
     data = newData;
     capacity = n;
     get = 0;
-    put = size;
+    put = size % capacity;
 }
 
 template <typename T, typename Allocator>
@@ -188,20 +219,54 @@ inline std::size_t Queue<T, Allocator>::calculateCapacity() const
 }
 
 template <typename T, typename Allocator>
-inline void Queue<T, Allocator>::copyFrom(const Queue<T, Allocator>& other)
+inline void Queue<T, Allocator>::relocate(T* dst)
 {
-    data = allocator.allocate(other.capacity);
+    if (size == 0) return;
 
-    for (std::size_t i = other.get; i != other.put; (++i) %= other.capacity)
+    std::size_t first = std::min(size, capacity - get);
+
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        std::memcpy(dst, data + get, first * sizeof(T));
+        if (size > first) std::memcpy(dst + first, data, (size - first) * sizeof(T));
+    }
+    else
     {
-        AllocatorT::construct(allocator, &data[i], other.data[i]);
+        for (std::size_t i = 0, idx = get; i < size; i++, (++idx) %= capacity)
+        {
+            AllocatorT::construct(allocator, &dst[i], std::move(data[idx]));
+            AllocatorT::destroy(allocator, &data[idx]);
+        }
     }
+}
+
+template <typename T, typename Allocator>
+inline void Queue<T, Allocator>::copyFrom(const Queue<T, Allocator>& other)
+{
+    data = other.capacity ? allocator.allocate(other.capacity) : nullptr;
 
     size = other.size;
     capacity = other.capacity;
 
-    get = other.get;
-    put = other.put;
+    get = 0;
+    put = capacity ? size % capacity : 0;
+
+    if (size == 0) return;
+
+    std::size_t first = std::min(size, capacity - other.get);
+
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        std::memcpy(data, other.data + other.get, first * sizeof(T));
+        if (size > first) std::memcpy(data + first, other.data, (size - first) * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0, idx = other.get; i < size; i++, (++idx) %= capacity)
+        {
+            AllocatorT::construct(allocator, &data[i], other.data[idx]);
+        }
+    }
 }
 
 template <typename T, typename Allocator>
@@ -217,13 +282,240 @@ inline void Queue<T, Allocator>::moveFrom(Queue<T, Allocator>&& other) noexcept
 template <typename T, typename Allocator>
 inline void Queue<T, Allocator>::free() noexcept
 {
-    for (std::size_t i = get; i != put; (++i) %= capacity)
+    for (std::size_t i = 0, idx = get; i < size; i++, (++idx) %= capacity)
     {
-        AllocatorT::destroy(allocator, &data[i]);
+        AllocatorT::destroy(allocator, &data[idx]);
     }
 
-    allocator.deallocate(data, capacity);
+    if (data) allocator.deallocate(data, capacity);
 
     data = nullptr;
     size = capacity = get = put = 0;
-}
\ No newline at end of file
+}
+
+template <typename T, typename Allocator = std::allocator<T>>
+class SPSCQueue
+{
+private:
+    T* data;
+    std::size_t capacity;
+    std::size_t mask;
+
+    Allocator allocator;
+    using AllocatorT = std::allocator_traits<Allocator>;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::size_t> get;
+    std::size_t cachedPut;
+
+    alignas(Hardware::CACHE_LINE_SIZE) std::atomic<std::size_t> put;
+    std::size_t cachedGet;
+
+    alignas(Hardware::CACHE_LINE_SIZE) char padding;
+
+public:
+    explicit SPSCQueue(std::size_t n);
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+
+    bool try_push(const T& val);
+    bool try_push(T&& val);
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    std::size_t push_n(const T* src, std::size_t n);
+
+    T* front();
+
+    bool pop();
+    bool try_pop(T& out);
+
+    std::size_t pop_n(T* dst, std::size_t n);
+
+    SPSCQueue(const SPSCQueue<T, Allocator>& other) = delete;
+    SPSCQueue<T, Allocator>& operator=(const SPSCQueue<T, Allocator>& other) = delete;
+
+    ~SPSCQueue() noexcept;
+
+private:
+    std::size_t writable(std::size_t pos, std::size_t n);
+    std::size_t readable(std::size_t pos, std::size_t n);
+};
+
+template <typename T, typename Allocator>
+SPSCQueue<T, Allocator>::SPSCQueue(std::size_t n)
+    :   data(nullptr),
+        capacity(Bits::nextPowerOfTwo(n)),
+        mask(capacity - 1),
+        get(0),
+        cachedPut(0),
+        put(0),
+        cachedGet(0),
+        padding(0)
+{
+    data = allocator.allocate(capacity);
+}
+
+template <typename T, typename Allocator>
+inline std::size_t SPSCQueue<T, Allocator>::getSize() const
+{
+    return put.load(std::memory_order_acquire) - get.load(std::memory_order_acquire);
+}
+
+template <typename T, typename Allocator>
+inline std::size_t SPSCQueue<T, Allocator>::getCapacity() const
+{
+    return capacity;
+}
+
+template <typename T, typename Allocator>
+inline bool SPSCQueue<T, Allocator>::isEmpty() const
+{
+    return getSize() == 0;
+}
+
+template <typename T, typename Allocator>
+inline bool SPSCQueue<T, Allocator>::try_push(const T& val)
+{
+    return try_emplace(val);
+}
+
+template <typename T, typename Allocator>
+inline bool SPSCQueue<T, Allocator>::try_push(T&& val)
+{
+    return try_emplace(std::move(val));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline bool SPSCQueue<T, Allocator>::try_emplace(Args&&... args)
+{
+    std::size_t pos = put.load(std::memory_order_relaxed);
+    if (writable(pos, 1) == 0) return false;
+
+    AllocatorT::construct(allocator, &data[pos & mask], std::forward<Args>(args)...);
+    put.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+std::size_t SPSCQueue<T, Allocator>::push_n(const T* src, std::size_t n)
+{
+    std::size_t pos = put.load(std::memory_order_relaxed);
+    n = writable(pos, n);
+
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        std::size_t idx = pos & mask;
+        std::size_t first = std::min(n, capacity - idx);
+
+        if (first) std::memcpy(data + idx, src, first * sizeof(T));
+        if (n > first) std::memcpy(data, src + first, (n - first) * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            AllocatorT::construct(allocator, &data[(pos + i) & mask], src[i]);
+        }
+    }
+
+    put.store(pos + n, std::memory_order_release);
+    return n;
+}
+
+template <typename T, typename Allocator>
+inline T* SPSCQueue<T, Allocator>::front()
+{
+    std::size_t pos = get.load(std::memory_order_relaxed);
+    return readable(pos, 1) ? &data[pos & mask] : nullptr;
+}
+
+template <typename T, typename Allocator>
+inline bool SPSCQueue<T, Allocator>::pop()
+{
+    std::size_t pos = get.load(std::memory_order_relaxed);
+    if (readable(pos, 1) == 0) return false;
+
+    AllocatorT::destroy(allocator, &data[pos & mask]);
+    get.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+inline bool SPSCQueue<T, Allocator>::try_pop(T& out)
+{
+    std::size_t pos = get.load(std::memory_order_relaxed);
+    if (readable(pos, 1) == 0) return false;
+
+    out = std::move(data[pos & mask]);
+    AllocatorT::destroy(allocator, &data[pos & mask]);
+    get.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Allocator>
+std::size_t SPSCQueue<T, Allocator>::pop_n(T* dst, std::size_t n)
+{
+    std::size_t pos = get.load(std::memory_order_relaxed);
+    n = readable(pos, n);
+
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        std::size_t idx = pos & mask;
+        std::size_t first = std::min(n, capacity - idx);
+
+        if (first) std::memcpy(dst, data + idx, first * sizeof(T));
+        if (n > first) std::memcpy(dst + first, data, (n - first) * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            T& slot = data[(pos + i) & mask];
+            dst[i] = std::move(slot);
+            AllocatorT::destroy(allocator, &slot);
+        }
+    }
+
+    get.store(pos + n, std::memory_order_release);
+    return n;
+}
+
+template <typename T, typename Allocator>
+SPSCQueue<T, Allocator>::~SPSCQueue() noexcept
+{
+    std::size_t end = put.load(std::memory_order_acquire);
+
+    for (std::size_t pos = get.load(std::memory_order_acquire); pos != end; pos++)
+    {
+        AllocatorT::destroy(allocator, &data[pos & mask]);
+    }
+
+    allocator.deallocate(data, capacity);
+}
+
+template <typename T, typename Allocator>
+inline std::size_t SPSCQueue<T, Allocator>::writable(std::size_t pos, std::size_t n)
+{
+    if (capacity - (pos - cachedGet) < n)
+    {
+        cachedGet = get.load(std::memory_order_acquire);
+    }
+
+    return std::min(n, capacity - (pos - cachedGet));
+}
+
+template <typename T, typename Allocator>
+inline std::size_t SPSCQueue<T, Allocator>::readable(std::size_t pos, std::size_t n)
+{
+    if (cachedPut - pos < n)
+    {
+        cachedPut = put.load(std::memory_order_acquire);
+    }
+
+    return std::min(n, cachedPut - pos);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+template <typename T>
+class Span
+{
+private:
+    T* ptr;
+    std::size_t size;
+
+public:
+    Span();
+    Span(T* ptr, std::size_t size);
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U(*)[], T(*)[]>::value>>
+    Span(const Span<U>& other) : ptr(other.getData()), size(other.getSize()) {}
+
+    T* begin() const;
+    T* end() const;
+
+    T* getData() const;
+    std::size_t getSize() const;
+    std::size_t getBytes() const;
+
+    bool isEmpty() const;
+
+    T& operator[](std::size_t idx) const;
+
+    Span<T> subspan(std::size_t offset, std::size_t count) const;
+};
+
+template <typename T>
+Span<T>::Span() : ptr(nullptr), size(0)
+{
+}
+
+template <typename T>
+Span<T>::Span(T* ptr, std::size_t size) : ptr(ptr), size(size)
+{
+}
+
+template <typename T>
+inline T* Span<T>::begin() const
+{
+    return ptr;
+}
+
+template <typename T>
+inline T* Span<T>::end() const
+{
+    return ptr + size;
+}
+
+template <typename T>
+inline T* Span<T>::getData() const
+{
+    return ptr;
+}
+
+template <typename T>
+inline std::size_t Span<T>::getSize() const
+{
+    return size;
+}
+
+template <typename T>
+inline std::size_t Span<T>::getBytes() const
+{
+    return size * sizeof(T);
+}
+
+template <typename T>
+inline bool Span<T>::isEmpty() const
+{
+    return size == 0;
+}
+
+template <typename T>
+inline T& Span<T>::operator[](std::size_t idx) const
+{
+    return ptr[idx];
+}
+
+template <typename T>
+inline Span<T> Span<T>::subspan(std::size_t offset, std::size_t count) const
+{
+    return Span<T>(ptr + offset, count);
+}
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+template <typename T, std::size_t N>
+class FixedStack
+{
+    static_assert(N > 0, "FixedStack requires a capacity of at least one element");
+
+private:
+    std::size_t size;
+
+    alignas(T) unsigned char storage[N * sizeof(T)];
+
+public:
+    FixedStack();
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+    bool isFull() const;
+
+    FixedStack<T, N>& push(const T& val);
+    FixedStack<T, N>& push(T&& val);
+
+    template <typename... Args>
+    FixedStack<T, N>& emplace(Args&&... args);
+
+    bool try_push(const T& val);
+    bool try_push(T&& val);
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args);
+
+    template <typename InputIt>
+    FixedStack<T, N>& push_range(InputIt first, InputIt last);
+
+    FixedStack<T, N>& pop();
+    FixedStack<T, N>& pop_n(std::size_t n);
+
+    const T& top() const;
+    T& top();
+
+    FixedStack<T, N>& clear();
+
+    FixedStack(const FixedStack<T, N>& other);
+    FixedStack<T, N>& operator=(const FixedStack<T, N>& other);
+
+    FixedStack(FixedStack<T, N>&& other) noexcept;
+    FixedStack<T, N>& operator=(FixedStack<T, N>&& other) noexcept;
+
+    ~FixedStack() noexcept;
+
+private:
+    T* data();
+    const T* data() const;
+
+    void copyFrom(const FixedStack<T, N>& other);
+    void moveFrom(FixedStack<T, N>&& other) noexcept;
+};
+
+template <typename T, std::size_t N>
+FixedStack<T, N>::FixedStack() : size(0)
+{
+}
+
+template <typename T, std::size_t N>
+inline std::size_t FixedStack<T, N>::getSize() const
+{
+    return size;
+}
+
+template <typename T, std::size_t N>
+inline std::size_t FixedStack<T, N>::getCapacity() const
+{
+    return N;
+}
+
+template <typename T, std::size_t N>
+inline bool FixedStack<T, N>::isEmpty() const
+{
+    return size == 0;
+}
+
+template <typename T, std::size_t N>
+inline bool FixedStack<T, N>::isFull() const
+{
+    return size == N;
+}
+
+template <typename T, std::size_t N>
+inline FixedStack<T, N>& FixedStack<T, N>::push(const T& val)
+{
+    return emplace(val);
+}
+
+template <typename T, std::size_t N>
+inline FixedStack<T, N>& FixedStack<T, N>::push(T&& val)
+{
+    return emplace(std::move(val));
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+inline FixedStack<T, N>& FixedStack<T, N>::emplace(Args&&... args)
+{
+    if (!try_emplace(std::forward<Args>(args)...)) throw std::length_error("FixedStack capacity exceeded");
+    return *this;
+}
+
+template <typename T, std::size_t N>
+inline bool FixedStack<T, N>::try_push(const T& val)
+{
+    return try_emplace(val);
+}
+
+template <typename T, std::size_t N>
+inline bool FixedStack<T, N>::try_push(T&& val)
+{
+    return try_emplace(std::move(val));
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+inline bool FixedStack<T, N>::try_emplace(Args&&... args)
+{
+    if (isFull()) return false;
+
+    ::new (static_cast<void*>(data() + size)) T(std::forward<Args>(args)...);
+    size++;
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <typename InputIt>
+FixedStack<T, N>& FixedStack<T, N>::push_range(InputIt first, InputIt last)
+{
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value)
+    {
+        for (; first != last; ++first) emplace(*first);
+        return *this;
+    }
+    else
+    {
+        std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (n > N - size) throw std::length_error("FixedStack capacity exceeded");
+
+        if constexpr (std::is_trivially_copyable<T>::value && std::is_pointer<InputIt>::value
+            && std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>::value)
+        {
+            if (n) std::memcpy(data() + size, first, n * sizeof(T));
+            size += n;
+        }
+        else
+        {
+            for (; first != last; ++first, size++)
+            {
+                ::new (static_cast<void*>(data() + size)) T(*first);
+            }
+        }
+
+        return *this;
+    }
+}
+
+template <typename T, std::size_t N>
+inline FixedStack<T, N>& FixedStack<T, N>::pop()
+{
+    if (isEmpty()) return *this;
+    data()[--size].~T();
+    return *this;
+}
+
+template <typename T, std::size_t N>
+inline FixedStack<T, N>& FixedStack<T, N>::pop_n(std::size_t n)
+{
+    n = std::min(n, size);
+
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            data()[size - i].~T();
+        }
+    }
+
+    size -= n;
+    return *this;
+}
+
+template <typename T, std::size_t N>
+inline const T& FixedStack<T, N>::top() const
+{
+    return data()[size - 1];
+}
+
+template <typename T, std::size_t N>
+inline T& FixedStack<T, N>::top()
+{
+    return data()[size - 1];
+}
+
+template <typename T, std::size_t N>
+inline FixedStack<T, N>& FixedStack<T, N>::clear()
+{
+    return pop_n(size);
+}
+
+template <typename T, std::size_t N>
+FixedStack<T, N>::FixedStack(const FixedStack<T, N>& other) : size(0)
+{
+    copyFrom(other);
+}
+
+template <typename T, std::size_t N>
+FixedStack<T, N>& FixedStack<T, N>::operator=(const FixedStack<T, N>& other)
+{
+    if (this != &other)
+    {
+        clear();
+        copyFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t N>
+FixedStack<T, N>::FixedStack(FixedStack<T, N>&& other) noexcept : size(0)
+{
+    moveFrom(std::move(other));
+}
+
+template <typename T, std::size_t N>
+FixedStack<T, N>& FixedStack<T, N>::operator=(FixedStack<T, N>&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        moveFrom(std::move(other));
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t N>
+FixedStack<T, N>::~FixedStack() noexcept
+{
+    clear();
+}
+
+template <typename T, std::size_t N>
+inline T* FixedStack<T, N>::data()
+{
+    return reinterpret_cast<T*>(storage);
+}
+
+template <typename T, std::size_t N>
+inline const T* FixedStack<T, N>::data() const
+{
+    return reinterpret_cast<const T*>(storage);
+}
+
+template <typename T, std::size_t N>
+inline void FixedStack<T, N>::copyFrom(const FixedStack<T, N>& other)
+{
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (other.size) std::memcpy(data(), other.data(), other.size * sizeof(T));
+        size = other.size;
+    }
+    else
+    {
+        for (; size < other.size; size++)
+        {
+            ::new (static_cast<void*>(data() + size)) T(other.data()[size]);
+        }
+    }
+}
+
+template <typename T, std::size_t N>
+inline void FixedStack<T, N>::moveFrom(FixedStack<T, N>&& other) noexcept
+{
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (other.size) std::memcpy(data(), other.data(), other.size * sizeof(T));
+        size = other.size;
+    }
+    else
+    {
+        for (; size < other.size; size++)
+        {
+            ::new (static_cast<void*>(data() + size)) T(std::move(other.data()[size]));
+        }
+    }
+
+    other.clear();
+}
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class SmallStack
+{
+    static_assert(N > 0, "SmallStack requires at least one inline element");
+
+private:
+    static constexpr std::size_t GROWTH_FACTOR = 2;
+
+    T* data;
+    std::size_t size;
+    std::size_t capacity;
+
+    alignas(T) unsigned char storage[N * sizeof(T)];
+
+    Allocator allocator;
+    using AllocatorT = std::allocator_traits<Allocator>;
+
+public:
+    SmallStack();
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+    bool isInline() const;
+
+    SmallStack<T, N, Allocator>& push(const T& val);
+    SmallStack<T, N, Allocator>& push(T&& val);
+
+    template <typename... Args>
+    SmallStack<T, N, Allocator>& emplace(Args&&... args);
+
+    template <typename InputIt>
+    SmallStack<T, N, Allocator>& push_range(InputIt first, InputIt last);
+
+    SmallStack<T, N, Allocator>& pop();
+    SmallStack<T, N, Allocator>& pop_n(std::size_t n);
+
+    const T& top() const;
+    T& top();
+
+    SmallStack<T, N, Allocator>& reserve(std::size_t n);
+    SmallStack<T, N, Allocator>& clear();
+
+    SmallStack(const SmallStack<T, N, Allocator>& other);
+    SmallStack<T, N, Allocator>& operator=(const SmallStack<T, N, Allocator>& other);
+
+    SmallStack(SmallStack<T, N, Allocator>&& other) noexcept;
+    SmallStack<T, N, Allocator>& operator=(SmallStack<T, N, Allocator>&& other) noexcept;
+
+    ~SmallStack() noexcept;
+
+private:
+    T* inlineData();
+
+    void resize(std::size_t n);
+    std::size_t calculateCapacity() const;
+
+    template <typename... Args>
+    void growEmplace(Args&&... args);
+
+    void relocate(T* src, T* dst, std::size_t n);
+
+    void copyFrom(const SmallStack<T, N, Allocator>& other);
+    void moveFrom(SmallStack<T, N, Allocator>&& other) noexcept;
+    void free() noexcept;
+};
+
+template <typename T, std::size_t N, typename Allocator>
+SmallStack<T, N, Allocator>::SmallStack() : data(nullptr), size(0), capacity(N)
+{
+    data = inlineData();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline std::size_t SmallStack<T, N, Allocator>::getSize() const
+{
+    return size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline std::size_t SmallStack<T, N, Allocator>::getCapacity() const
+{
+    return capacity;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline bool SmallStack<T, N, Allocator>::isEmpty() const
+{
+    return size == 0;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline bool SmallStack<T, N, Allocator>::isInline() const
+{
+    return capacity == N;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::push(const T& val)
+{
+    return emplace(val);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::push(T&& val)
+{
+    return emplace(std::move(val));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+inline SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::emplace(Args&&... args)
+{
+    if (size >= capacity)
+    {
+        growEmplace(std::forward<Args>(args)...);
+        return *this;
+    }
+
+    AllocatorT::construct(allocator, &data[size], std::forward<Args>(args)...);
+    size++;
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename InputIt>
+SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::push_range(InputIt first, InputIt last)
+{
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value)
+    {
+        for (; first != last; ++first) emplace(*first);
+        return *this;
+    }
+    else
+    {
+        std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (size + n > capacity) resize(std::max(size + n, calculateCapacity()));
+
+        if constexpr (std::is_trivially_copyable<T>::value && std::is_pointer<InputIt>::value
+            && std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>::value)
+        {
+            if (n) std::memcpy(data + size, first, n * sizeof(T));
+            size += n;
+        }
+        else
+        {
+            for (; first != last; ++first, size++)
+            {
+                AllocatorT::construct(allocator, &data[size], *first);
+            }
+        }
+
+        return *this;
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::pop()
+{
+    if (isEmpty()) return *this;
+    AllocatorT::destroy(allocator, &data[--size]);
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::pop_n(std::size_t n)
+{
+    n = std::min(n, size);
+
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            AllocatorT::destroy(allocator, &data[size - i]);
+        }
+    }
+
+    size -= n;
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline const T& SmallStack<T, N, Allocator>::top() const
+{
+    return data[size - 1];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline T& SmallStack<T, N, Allocator>::top()
+{
+    return data[size - 1];
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::reserve(std::size_t n)
+{
+    if (n > capacity) resize(n);
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::clear()
+{
+    return pop_n(size);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallStack<T, N, Allocator>::SmallStack(const SmallStack<T, N, Allocator>& other) : data(nullptr), size(0), capacity(N)
+{
+    data = inlineData();
+    copyFrom(other);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::operator=(const SmallStack<T, N, Allocator>& other)
+{
+    if (this != &other)
+    {
+        free();
+        copyFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallStack<T, N, Allocator>::SmallStack(SmallStack<T, N, Allocator>&& other) noexcept : data(nullptr), size(0), capacity(N)
+{
+    data = inlineData();
+    moveFrom(std::move(other));
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallStack<T, N, Allocator>& SmallStack<T, N, Allocator>::operator=(SmallStack<T, N, Allocator>&& other) noexcept
+{
+    if (this != &other)
+    {
+        free();
+        moveFrom(std::move(other));
+    }
+
+    return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallStack<T, N, Allocator>::~SmallStack() noexcept
+{
+    free();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline T* SmallStack<T, N, Allocator>::inlineData()
+{
+    return reinterpret_cast<T*>(storage);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline void SmallStack<T, N, Allocator>::resize(std::size_t n)
+{
+    T* newData = allocator.allocate(n);
+
+    relocate(data, newData, size);
+
+    if (!isInline()) allocator.deallocate(data, capacity);
+
+    data = newData;
+    capacity = n;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline std::size_t SmallStack<T, N, Allocator>::calculateCapacity() const
+{
+    return capacity * GROWTH_FACTOR;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+template <typename... Args>
+void SmallStack<T, N, Allocator>::growEmplace(Args&&... args)
+{
+    std::size_t n = calculateCapacity();
+    T* newData = allocator.allocate(n);
+
+    try
+    {
+        AllocatorT::construct(allocator, &newData[size], std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        allocator.deallocate(newData, n);
+        throw;
+    }
+
+    relocate(data, newData, size);
+
+    if (!isInline()) allocator.deallocate(data, capacity);
+
+    data = newData;
+    capacity = n;
+    size++;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline void SmallStack<T, N, Allocator>::relocate(T* src, T* dst, std::size_t n)
+{
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (n) std::memcpy(dst, src, n * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            AllocatorT::construct(allocator, &dst[i], std::move(src[i]));
+            AllocatorT::destroy(allocator, &src[i]);
+        }
+    }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline void SmallStack<T, N, Allocator>::copyFrom(const SmallStack<T, N, Allocator>& other)
+{
+    if (other.size > capacity)
+    {
+        data = allocator.allocate(other.size);
+        capacity = other.size;
+    }
+
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (other.size) std::memcpy(data, other.data, other.size * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < other.size; i++)
+        {
+            AllocatorT::construct(allocator, &data[i], other.data[i]);
+        }
+    }
+
+    size = other.size;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline void SmallStack<T, N, Allocator>::moveFrom(SmallStack<T, N, Allocator>&& other) noexcept
+{
+    if (other.isInline())
+    {
+        relocate(other.data, data, other.size);
+        size = std::exchange(other.size, 0);
+        return;
+    }
+
+    data = std::exchange(other.data, other.inlineData());
+    size = std::exchange(other.size, 0);
+    capacity = std::exchange(other.capacity, N);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+inline void SmallStack<T, N, Allocator>::free() noexcept
+{
+    pop_n(size);
+
+    if (!isInline()) allocator.deallocate(data, capacity);
+
+    data = inlineData();
+    capacity = N;
+}
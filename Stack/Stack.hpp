@@ -3,6 +3,10 @@
 #include <iostream>
 #include <memory>
 #include <utility>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 namespace Constants
 {
@@ -31,9 +35,19 @@ public:
     Stack<T, Allocator>& push(const T& val);
     Stack<T, Allocator>& push(T&& val);
 
+    template <typename... Args>
+    Stack<T, Allocator>& emplace(Args&&... args);
+
+    template <typename InputIt>
+    Stack<T, Allocator>& push_range(InputIt first, InputIt last);
+
     Stack<T, Allocator>& pop();
+    Stack<T, Allocator>& pop_n(std::size_t n);
 
     const T& top() const;
+    T& top();
+
+    Stack<T, Allocator>& reserve(std::size_t n);
 
     Stack(const Stack<T, Allocator>& other);
     Stack<T, Allocator>& operator=(const Stack<T, Allocator>& other);
@@ -47,6 +61,11 @@ private:
     void resize(std::size_t n);
     std::size_t calculateCapacity() const;
 
+    template <typename... Args>
+    void growEmplace(Args&&... args);
+
+    void relocate(T* dst);
+
     void copyFrom(const Stack<T, Allocator>& other);
     void moveFrom(Stack<T, Allocator>&& other) noexcept;
     void free() noexcept;
@@ -78,19 +97,64 @@ bool Stack<T, Allocator>::isEmpty() const
 template <typename T, typename Allocator>
 inline Stack<T, Allocator>& Stack<T, Allocator>::push(const T& val)
 {
-    if (size >= capacity) resize(calculateCapacity());
-    data[size++] = val;
-    return *this;
+    return emplace(val);
 }
 
 template <typename T, typename Allocator>
 inline Stack<T, Allocator>& Stack<T, Allocator>::push(T&& val)
 {
-    if (size >= capacity) resize(calculateCapacity());
-    data[size++] = std::move(val);
+    return emplace(std::move(val));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline Stack<T, Allocator>& Stack<T, Allocator>::emplace(Args&&... args)
+{
+    if (size >= capacity)
+    {
+        growEmplace(std::forward<Args>(args)...);
+        return *this;
+    }
+
+    AllocatorT::construct(allocator, &data[size], std::forward<Args>(args)...);
+    size++;
     return *this;
 }
 
+template <typename T, typename Allocator>
+template <typename InputIt>
+Stack<T, Allocator>& Stack<T, Allocator>::push_range(InputIt first, InputIt last)
+{
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+    if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value)
+    {
+        for (; first != last; ++first) emplace(*first);
+        return *this;
+    }
+    else
+    {
+        std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (size + n > capacity) resize(std::max(size + n, calculateCapacity()));
+
+        if constexpr (std::is_trivially_copyable<T>::value && std::is_pointer<InputIt>::value
+            && std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>::value)
+        {
+            if (n) std::memcpy(data + size, first, n * sizeof(T));
+            size += n;
+        }
+        else
+        {
+            for (; first != last; ++first, size++)
+            {
+                AllocatorT::construct(allocator, &data[size], *first);
+            }
+        }
+
+        return *this;
+    }
+}
+
 template <typename T, typename Allocator>
 Stack<T, Allocator>& Stack<T, Allocator>::pop()
 {
@@ -99,12 +163,42 @@ Stack<T, Allocator>& Stack<T, Allocator>::pop()
     return *this;
 }
 
+template <typename T, typename Allocator>
+inline Stack<T, Allocator>& Stack<T, Allocator>::pop_n(std::size_t n)
+{
+    n = std::min(n, size);
+
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            AllocatorT::destroy(allocator, &data[size - i]);
+        }
+    }
+
+    size -= n;
+    return *this;
+}
+
 template <typename T, typename Allocator>
 const T& Stack<T, Allocator>::top() const
 {
     return data[size - 1];
 }
 
+template <typename T, typename Allocator>
+T& Stack<T, Allocator>::top()
+{
+    return data[size - 1];
+}
+
+template <typename T, typename Allocator>
+inline Stack<T, Allocator>& Stack<T, Allocator>::reserve(std::size_t n)
+{
+    if (n > capacity) resize(n);
+    return *this;
+}
+
 template <typename T, typename Allocator>
 Stack<T, Allocator>::Stack(const Stack<T, Allocator>& other)
 {
@@ -152,14 +246,10 @@ inline void Stack<T, Allocator>::resize(std::size_t n)
 {
     T* newData = allocator.allocate(n);
 
-    for (std::size_t i = 0; i < size; i++)
-    {
-        AllocatorT::construct(allocator, &newData[i], std::move(data[i]));
-        AllocatorT::destroy(allocator, &data[i]);
-    }
+    relocate(newData);
+
+    if (data) allocator.deallocate(data, capacity);
 
-    allocator.deallocate(data, capacity);
-    
     data = newData;
     capacity = n;
 }
@@ -170,14 +260,64 @@ inline std::size_t Stack<T, Allocator>::calculateCapacity() const
     return capacity ? capacity * Constants::GROWTH_FACTOR : 1;
 }
 
+template <typename T, typename Allocator>
+template <typename... Args>
+void Stack<T, Allocator>::growEmplace(Args&&... args)
+{
+    std::size_t n = calculateCapacity();
+    T* newData = allocator.allocate(n);
+
+    try
+    {
+        AllocatorT::construct(allocator, &newData[size], std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        allocator.deallocate(newData, n);
+        throw;
+    }
+
+    relocate(newData);
+
+    if (data) allocator.deallocate(data, capacity);
+
+    data = newData;
+    capacity = n;
+    size++;
+}
+
+template <typename T, typename Allocator>
+inline void Stack<T, Allocator>::relocate(T* dst)
+{
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (size) std::memcpy(dst, data, size * sizeof(T));
+    }
+    else
+    {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            AllocatorT::construct(allocator, &dst[i], std::move(data[i]));
+            AllocatorT::destroy(allocator, &data[i]);
+        }
+    }
+}
+
 template <typename T, typename Allocator>
 inline void Stack<T, Allocator>::copyFrom(const Stack<T, Allocator>& other)
 {
-    data = allocator.allocate(other.capacity);
+    data = other.capacity ? allocator.allocate(other.capacity) : nullptr;
 
-    for (std::size_t i = 0; i < other.size; i++)
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+        if (other.size) std::memcpy(data, other.data, other.size * sizeof(T));
+    }
+    else
     {
-        AllocatorT::construct(allocator, &data[i], other.data[i]);
+        for (std::size_t i = 0; i < other.size; i++)
+        {
+            AllocatorT::construct(allocator, &data[i], other.data[i]);
+        }
     }
 
     size = other.size;
@@ -200,7 +340,7 @@ inline void Stack<T, Allocator>::free() noexcept
         AllocatorT::destroy(allocator, &data[i]);
     }
 
-    allocator.deallocate(data, capacity);
+    if (data) allocator.deallocate(data, capacity);
 
     data = nullptr;
     size = capacity = 0;
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <climits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Bits
+{
+    constexpr std::size_t WIDTH = sizeof(std::size_t) * CHAR_BIT;
+
+    constexpr bool isPowerOfTwo(std::size_t n)
+    {
+        return n != 0 && (n & (n - 1)) == 0;
+    }
+
+    constexpr std::size_t nextPowerOfTwo(std::size_t n)
+    {
+        if (n <= 1) return 1;
+
+        n--;
+        for (std::size_t shift = 1; shift < WIDTH; shift <<= 1)
+        {
+            n |= n >> shift;
+        }
+
+        return n + 1;
+    }
+
+    inline std::size_t log2Floor(std::size_t n)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return sizeof(unsigned long long) * CHAR_BIT - 1 - static_cast<std::size_t>(__builtin_clzll(static_cast<unsigned long long>(n)));
+#elif defined(_MSC_VER) && defined(_WIN64)
+        unsigned long idx;
+        _BitScanReverse64(&idx, n);
+        return idx;
+#else
+        std::size_t idx = 0;
+        while (n >>= 1) idx++;
+        return idx;
+#endif
+    }
+}
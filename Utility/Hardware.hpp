@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace Hardware
+{
+    constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    inline void pause()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        __asm__ __volatile__("yield");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
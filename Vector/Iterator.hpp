@@ -15,6 +15,10 @@ private:
 
 public:
     using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = Offset;
+    using pointer = Ptr;
+    using reference = Ref;
 
     VectorIterator(Ptr ptr);
 
@@ -183,6 +187,10 @@ private:
 
 public:
     using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = Offset;
+    using pointer = Ptr;
+    using reference = Ref;
 
     ConstVectorIterator(Ptr ptr);
     ConstVectorIterator(const VectorIterator<T>& other);
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Iterator.hpp"
+
+template <typename T>
+class MappedVector
+{
+private:
+    static_assert(std::is_trivially_copyable<T>::value, "MappedVector requires a trivially copyable type");
+
+    static constexpr std::size_t GROWTH_FACTOR = 2;
+
+    T* data;
+    std::size_t size;
+    std::size_t capacity;
+
+    int fd;
+
+public:
+    using Iterator = VectorIterator<T>;
+    using ConstIterator = ConstVectorIterator<T>;
+
+    Iterator begin()
+    {
+        return Iterator(data);
+    }
+
+    Iterator end()
+    {
+        return Iterator(data + size);
+    }
+
+    ConstIterator cbegin() const
+    {
+        return ConstIterator(data);
+    }
+
+    ConstIterator cend() const
+    {
+        return ConstIterator(data + size);
+    }
+
+public:
+    explicit MappedVector(const std::string& path);
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+
+    const T& front() const;
+    T& front();
+
+    const T& back() const;
+    T& back();
+
+    const T& operator[](std::size_t idx) const;
+    T& operator[](std::size_t idx);
+
+    MappedVector<T>& push_back(const T& val);
+
+    MappedVector<T>& pop_back();
+
+    template <typename... Args>
+    MappedVector<T>& emplace_back(Args&&... args);
+
+    MappedVector<T>& reserve(std::size_t n);
+    MappedVector<T>& clear();
+
+    MappedVector<T>& sync();
+
+    MappedVector(const MappedVector<T>& other) = delete;
+    MappedVector<T>& operator=(const MappedVector<T>& other) = delete;
+
+    MappedVector(MappedVector<T>&& other) noexcept;
+    MappedVector<T>& operator=(MappedVector<T>&& other) noexcept;
+
+    ~MappedVector() noexcept;
+
+private:
+    void remap(std::size_t n);
+    std::size_t calculateCapacity() const;
+
+    [[noreturn]] static void fail(const char* what);
+
+    void moveFrom(MappedVector<T>&& other) noexcept;
+    void free() noexcept;
+};
+
+template <typename T>
+MappedVector<T>::MappedVector(const std::string& path) : data(nullptr), size(0), capacity(0), fd(-1)
+{
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) fail("open");
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "fstat");
+    }
+
+    std::size_t bytes = static_cast<std::size_t>(info.st_size);
+
+    if (bytes % sizeof(T) != 0)
+    {
+        ::close(fd);
+        throw std::invalid_argument("MappedVector file size is not a multiple of the element size");
+    }
+
+    std::size_t elements = bytes / sizeof(T);
+
+    try
+    {
+        remap(elements);
+    }
+    catch (...)
+    {
+        ::close(fd);
+        throw;
+    }
+
+    size = elements;
+}
+
+template <typename T>
+inline std::size_t MappedVector<T>::getSize() const
+{
+    return size;
+}
+
+template <typename T>
+inline std::size_t MappedVector<T>::getCapacity() const
+{
+    return capacity;
+}
+
+template <typename T>
+inline bool MappedVector<T>::isEmpty() const
+{
+    return size == 0;
+}
+
+template <typename T>
+inline const T& MappedVector<T>::front() const
+{
+    return data[0];
+}
+
+template <typename T>
+inline T& MappedVector<T>::front()
+{
+    return data[0];
+}
+
+template <typename T>
+inline const T& MappedVector<T>::back() const
+{
+    return data[size - 1];
+}
+
+template <typename T>
+inline T& MappedVector<T>::back()
+{
+    return data[size - 1];
+}
+
+template <typename T>
+inline const T& MappedVector<T>::operator[](std::size_t idx) const
+{
+    return data[idx];
+}
+
+template <typename T>
+inline T& MappedVector<T>::operator[](std::size_t idx)
+{
+    return data[idx];
+}
+
+template <typename T>
+inline MappedVector<T>& MappedVector<T>::push_back(const T& val)
+{
+    if (size >= capacity) remap(calculateCapacity());
+    ::new (static_cast<void*>(data + size++)) T(val);
+    return *this;
+}
+
+template <typename T>
+inline MappedVector<T>& MappedVector<T>::pop_back()
+{
+    if (!isEmpty()) size--;
+    return *this;
+}
+
+template <typename T>
+template <typename... Args>
+inline MappedVector<T>& MappedVector<T>::emplace_back(Args&&... args)
+{
+    if (size >= capacity) remap(calculateCapacity());
+    ::new (static_cast<void*>(data + size++)) T(std::forward<Args>(args)...);
+    return *this;
+}
+
+template <typename T>
+inline MappedVector<T>& MappedVector<T>::reserve(std::size_t n)
+{
+    if (n > capacity) remap(n);
+    return *this;
+}
+
+template <typename T>
+inline MappedVector<T>& MappedVector<T>::clear()
+{
+    size = 0;
+    return *this;
+}
+
+template <typename T>
+inline MappedVector<T>& MappedVector<T>::sync()
+{
+    if (data && ::msync(data, capacity * sizeof(T), MS_SYNC) != 0) fail("msync");
+    return *this;
+}
+
+template <typename T>
+MappedVector<T>::MappedVector(MappedVector<T>&& other) noexcept
+{
+    moveFrom(std::move(other));
+}
+
+template <typename T>
+MappedVector<T>& MappedVector<T>::operator=(MappedVector<T>&& other) noexcept
+{
+    if (this != &other)
+    {
+        free();
+        moveFrom(std::move(other));
+    }
+
+    return *this;
+}
+
+template <typename T>
+MappedVector<T>::~MappedVector() noexcept
+{
+    free();
+}
+
+template <typename T>
+inline void MappedVector<T>::remap(std::size_t n)
+{
+    std::size_t oldBytes = capacity * sizeof(T);
+    std::size_t newBytes = n * sizeof(T);
+
+    if (::ftruncate(fd, static_cast<off_t>(newBytes)) != 0) fail("ftruncate");
+
+    void* mapped = nullptr;
+
+    if (newBytes == 0)
+    {
+        if (data) ::munmap(data, oldBytes);
+    }
+    else if (!data)
+    {
+        mapped = ::mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    else
+    {
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+        mapped = ::mremap(data, oldBytes, newBytes, MREMAP_MAYMOVE);
+#else
+        mapped = ::mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapped != MAP_FAILED) ::munmap(data, oldBytes);
+#endif
+    }
+
+    if (mapped == MAP_FAILED) fail("mmap");
+
+    data = static_cast<T*>(mapped);
+    capacity = n;
+}
+
+template <typename T>
+inline std::size_t MappedVector<T>::calculateCapacity() const
+{
+    return capacity ? capacity * GROWTH_FACTOR : 1;
+}
+
+template <typename T>
+inline void MappedVector<T>::fail(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+template <typename T>
+inline void MappedVector<T>::moveFrom(MappedVector<T>&& other) noexcept
+{
+    data = std::exchange(other.data, nullptr);
+    size = std::exchange(other.size, 0);
+    capacity = std::exchange(other.capacity, 0);
+    fd = std::exchange(other.fd, -1);
+}
+
+template <typename T>
+inline void MappedVector<T>::free() noexcept
+{
+    if (data) ::munmap(data, capacity * sizeof(T));
+
+    if (fd >= 0)
+    {
+        (void)::ftruncate(fd, static_cast<off_t>(size * sizeof(T)));
+        ::close(fd);
+    }
+
+    data = nullptr;
+    size = capacity = 0;
+    fd = -1;
+}
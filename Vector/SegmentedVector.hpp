@@ -0,0 +1,499 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <iterator>
+
+#include "../Utility/Bits.hpp"
+
+namespace Segments
+{
+    constexpr std::size_t FIRST_BLOCK_SHIFT = 4;
+    constexpr std::size_t FIRST_BLOCK_SIZE = std::size_t(1) << FIRST_BLOCK_SHIFT;
+    constexpr std::size_t MAX_BLOCKS = Bits::WIDTH - FIRST_BLOCK_SHIFT;
+
+    constexpr std::size_t blockSize(std::size_t block)
+    {
+        return FIRST_BLOCK_SIZE << block;
+    }
+
+    inline std::size_t blockOf(std::size_t idx)
+    {
+        return Bits::log2Floor(idx + FIRST_BLOCK_SIZE) - FIRST_BLOCK_SHIFT;
+    }
+
+    inline std::size_t offsetOf(std::size_t idx, std::size_t block)
+    {
+        return (idx + FIRST_BLOCK_SIZE) & (blockSize(block) - 1);
+    }
+}
+
+template <typename T, typename Ptr>
+class SegmentedIterator
+{
+private:
+    using Blocks = T* const*;
+    using Ref = decltype(*std::declval<Ptr>());
+    using Offset = std::ptrdiff_t;
+
+    Blocks blocks;
+    std::size_t index;
+
+    Ptr ptr;
+    Ptr blockEnd;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = Offset;
+    using pointer = Ptr;
+    using reference = Ref;
+
+    SegmentedIterator(Blocks blocks, std::size_t index) : blocks(blocks), index(index), ptr(nullptr), blockEnd(nullptr)
+    {
+        locate();
+    }
+
+    SegmentedIterator& operator++()
+    {
+        ++index;
+        if (++ptr == blockEnd) locate();
+        return *this;
+    }
+
+    SegmentedIterator operator++(int)
+    {
+        SegmentedIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    SegmentedIterator& operator--()
+    {
+        --index;
+        locate();
+        return *this;
+    }
+
+    SegmentedIterator operator--(int)
+    {
+        SegmentedIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    SegmentedIterator& operator+=(Offset offset)
+    {
+        index = static_cast<std::size_t>(static_cast<Offset>(index) + offset);
+        locate();
+        return *this;
+    }
+
+    SegmentedIterator& operator-=(Offset offset)
+    {
+        return *this += -offset;
+    }
+
+    SegmentedIterator operator+(Offset offset) const
+    {
+        SegmentedIterator temp = *this;
+        temp += offset;
+        return temp;
+    }
+
+    SegmentedIterator operator-(Offset offset) const
+    {
+        SegmentedIterator temp = *this;
+        temp -= offset;
+        return temp;
+    }
+
+    Offset operator-(const SegmentedIterator& other) const
+    {
+        return static_cast<Offset>(index) - static_cast<Offset>(other.index);
+    }
+
+    Ref operator*() const noexcept
+    {
+        return *ptr;
+    }
+
+    Ptr operator->() const noexcept
+    {
+        return ptr;
+    }
+
+    Ref operator[](Offset offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    bool operator==(const SegmentedIterator& other) const
+    {
+        return index == other.index;
+    }
+
+    bool operator!=(const SegmentedIterator& other) const
+    {
+        return index != other.index;
+    }
+
+    bool operator<(const SegmentedIterator& other) const
+    {
+        return index < other.index;
+    }
+
+    bool operator>(const SegmentedIterator& other) const
+    {
+        return index > other.index;
+    }
+
+    bool operator<=(const SegmentedIterator& other) const
+    {
+        return index <= other.index;
+    }
+
+    bool operator>=(const SegmentedIterator& other) const
+    {
+        return index >= other.index;
+    }
+
+private:
+    void locate()
+    {
+        std::size_t block = Segments::blockOf(index);
+
+        if (block >= Segments::MAX_BLOCKS || !blocks[block])
+        {
+            ptr = blockEnd = nullptr;
+            return;
+        }
+
+        ptr = blocks[block] + Segments::offsetOf(index, block);
+        blockEnd = blocks[block] + Segments::blockSize(block);
+    }
+};
+
+template <typename T, typename Allocator = std::allocator<T>>
+class SegmentedVector
+{
+private:
+    T* blocks[Segments::MAX_BLOCKS];
+    std::size_t blockCount;
+
+    std::size_t size;
+    std::size_t capacity;
+
+    Allocator allocator;
+    using AllocatorT = std::allocator_traits<Allocator>;
+
+public:
+    using Iterator = SegmentedIterator<T, T*>;
+    using ConstIterator = SegmentedIterator<T, const T*>;
+
+    Iterator begin()
+    {
+        return Iterator(blocks, 0);
+    }
+
+    Iterator end()
+    {
+        return Iterator(blocks, size);
+    }
+
+    ConstIterator cbegin() const
+    {
+        return ConstIterator(blocks, 0);
+    }
+
+    ConstIterator cend() const
+    {
+        return ConstIterator(blocks, size);
+    }
+
+public:
+    SegmentedVector();
+    explicit SegmentedVector(std::size_t n);
+    SegmentedVector(std::size_t n, const T& val);
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+
+    const T& front() const;
+    T& front();
+
+    const T& back() const;
+    T& back();
+
+    const T& operator[](std::size_t idx) const;
+    T& operator[](std::size_t idx);
+
+    SegmentedVector<T, Allocator>& push_back(const T& val);
+    SegmentedVector<T, Allocator>& push_back(T&& val);
+
+    SegmentedVector<T, Allocator>& pop_back();
+
+    template <typename... Args>
+    SegmentedVector<T, Allocator>& emplace_back(Args&&... args);
+
+    SegmentedVector<T, Allocator>& reserve(std::size_t n);
+    SegmentedVector<T, Allocator>& shrink_to_fit();
+    SegmentedVector<T, Allocator>& clear();
+
+    SegmentedVector(const SegmentedVector<T, Allocator>& other);
+    SegmentedVector<T, Allocator>& operator=(const SegmentedVector<T, Allocator>& other);
+
+    SegmentedVector(SegmentedVector<T, Allocator>&& other) noexcept;
+    SegmentedVector<T, Allocator>& operator=(SegmentedVector<T, Allocator>&& other) noexcept;
+
+    ~SegmentedVector() noexcept;
+
+private:
+    T* slot(std::size_t idx) const;
+    void addBlock();
+
+    void copyFrom(const SegmentedVector<T, Allocator>& other);
+    void moveFrom(SegmentedVector<T, Allocator>&& other) noexcept;
+    void free() noexcept;
+};
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>::SegmentedVector() : blocks(), blockCount(0), size(0), capacity(0)
+{
+}
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>::SegmentedVector(std::size_t n) : SegmentedVector()
+{
+    reserve(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        AllocatorT::construct(allocator, slot(size++));
+    }
+}
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>::SegmentedVector(std::size_t n, const T& val) : SegmentedVector()
+{
+    reserve(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        AllocatorT::construct(allocator, slot(size++), val);
+    }
+}
+
+template <typename T, typename Allocator>
+inline std::size_t SegmentedVector<T, Allocator>::getSize() const
+{
+    return size;
+}
+
+template <typename T, typename Allocator>
+inline std::size_t SegmentedVector<T, Allocator>::getCapacity() const
+{
+    return capacity;
+}
+
+template <typename T, typename Allocator>
+inline bool SegmentedVector<T, Allocator>::isEmpty() const
+{
+    return size == 0;
+}
+
+template <typename T, typename Allocator>
+inline const T& SegmentedVector<T, Allocator>::front() const
+{
+    return blocks[0][0];
+}
+
+template <typename T, typename Allocator>
+inline T& SegmentedVector<T, Allocator>::front()
+{
+    return blocks[0][0];
+}
+
+template <typename T, typename Allocator>
+inline const T& SegmentedVector<T, Allocator>::back() const
+{
+    return *slot(size - 1);
+}
+
+template <typename T, typename Allocator>
+inline T& SegmentedVector<T, Allocator>::back()
+{
+    return *slot(size - 1);
+}
+
+template <typename T, typename Allocator>
+inline const T& SegmentedVector<T, Allocator>::operator[](std::size_t idx) const
+{
+    return *slot(idx);
+}
+
+template <typename T, typename Allocator>
+inline T& SegmentedVector<T, Allocator>::operator[](std::size_t idx)
+{
+    return *slot(idx);
+}
+
+template <typename T, typename Allocator>
+inline SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::push_back(const T& val)
+{
+    if (size >= capacity) addBlock();
+    AllocatorT::construct(allocator, slot(size), val);
+    size++;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::push_back(T&& val)
+{
+    if (size >= capacity) addBlock();
+    AllocatorT::construct(allocator, slot(size), std::move(val));
+    size++;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::pop_back()
+{
+    if (isEmpty()) return *this;
+
+    AllocatorT::destroy(allocator, slot(--size));
+    return *this;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+inline SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::emplace_back(Args&&... args)
+{
+    if (size >= capacity) addBlock();
+    AllocatorT::construct(allocator, slot(size), std::forward<Args>(args)...);
+    size++;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::reserve(std::size_t n)
+{
+    while (capacity < n) addBlock();
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::shrink_to_fit()
+{
+    while (blockCount > 0 && capacity - Segments::blockSize(blockCount - 1) >= size)
+    {
+        blockCount--;
+
+        allocator.deallocate(blocks[blockCount], Segments::blockSize(blockCount));
+        blocks[blockCount] = nullptr;
+
+        capacity -= Segments::blockSize(blockCount);
+    }
+
+    return *this;
+}
+
+template <typename T, typename Allocator>
+inline SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::clear()
+{
+    while (size) AllocatorT::destroy(allocator, slot(--size));
+    return *this;
+}
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>::SegmentedVector(const SegmentedVector<T, Allocator>& other) : SegmentedVector()
+{
+    copyFrom(other);
+}
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::operator=(const SegmentedVector<T, Allocator>& other)
+{
+    if (this != &other)
+    {
+        free();
+        copyFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>::SegmentedVector(SegmentedVector<T, Allocator>&& other) noexcept
+{
+    moveFrom(std::move(other));
+}
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>& SegmentedVector<T, Allocator>::operator=(SegmentedVector<T, Allocator>&& other) noexcept
+{
+    if (this != &other)
+    {
+        free();
+        moveFrom(std::move(other));
+    }
+
+    return *this;
+}
+
+template <typename T, typename Allocator>
+SegmentedVector<T, Allocator>::~SegmentedVector() noexcept
+{
+    free();
+}
+
+template <typename T, typename Allocator>
+inline T* SegmentedVector<T, Allocator>::slot(std::size_t idx) const
+{
+    std::size_t block = Segments::blockOf(idx);
+    return blocks[block] + Segments::offsetOf(idx, block);
+}
+
+template <typename T, typename Allocator>
+inline void SegmentedVector<T, Allocator>::addBlock()
+{
+    std::size_t n = Segments::blockSize(blockCount);
+
+    blocks[blockCount++] = allocator.allocate(n);
+    capacity += n;
+}
+
+template <typename T, typename Allocator>
+inline void SegmentedVector<T, Allocator>::copyFrom(const SegmentedVector<T, Allocator>& other)
+{
+    reserve(other.size);
+
+    for (std::size_t i = 0; i < other.size; i++)
+    {
+        AllocatorT::construct(allocator, slot(size), *other.slot(i));
+        size++;
+    }
+}
+
+template <typename T, typename Allocator>
+inline void SegmentedVector<T, Allocator>::moveFrom(SegmentedVector<T, Allocator>&& other) noexcept
+{
+    for (std::size_t i = 0; i < Segments::MAX_BLOCKS; i++)
+    {
+        blocks[i] = std::exchange(other.blocks[i], nullptr);
+    }
+
+    blockCount = std::exchange(other.blockCount, 0);
+    size = std::exchange(other.size, 0);
+    capacity = std::exchange(other.capacity, 0);
+}
+
+template <typename T, typename Allocator>
+inline void SegmentedVector<T, Allocator>::free() noexcept
+{
+    clear();
+    shrink_to_fit();
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+template <typename... Fields>
+class SoAIterator
+{
+private:
+    using Ptrs = std::tuple<Fields*...>;
+    using Ref = std::tuple<Fields&...>;
+    using Offset = std::ptrdiff_t;
+
+    Ptrs ptrs;
+    std::size_t index;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<std::remove_const_t<Fields>...>;
+    using difference_type = Offset;
+    using pointer = void;
+    using reference = Ref;
+
+    SoAIterator(const Ptrs& ptrs, std::size_t index);
+
+    SoAIterator<Fields...>& operator++();
+    SoAIterator<Fields...> operator++(int);
+
+    SoAIterator<Fields...>& operator--();
+    SoAIterator<Fields...> operator--(int);
+
+    SoAIterator<Fields...>& operator+=(Offset offset);
+    SoAIterator<Fields...>& operator-=(Offset offset);
+
+    SoAIterator<Fields...> operator+(Offset offset) const;
+    SoAIterator<Fields...> operator-(Offset offset) const;
+
+    Offset operator-(const SoAIterator<Fields...>& other) const;
+
+    Ref operator*() const noexcept;
+    Ref operator[](Offset offset) const noexcept;
+
+    bool operator==(const SoAIterator<Fields...>& other) const;
+    bool operator!=(const SoAIterator<Fields...>& other) const;
+
+    bool operator<(const SoAIterator<Fields...>& other) const;
+    bool operator>(const SoAIterator<Fields...>& other) const;
+
+    bool operator<=(const SoAIterator<Fields...>& other) const;
+    bool operator>=(const SoAIterator<Fields...>& other) const;
+
+private:
+    template <std::size_t... I>
+    Ref row(std::size_t idx, std::index_sequence<I...>) const noexcept;
+};
+
+template <typename... Fields>
+SoAIterator<Fields...>::SoAIterator(const Ptrs& ptrs, std::size_t index) : ptrs(ptrs), index(index)
+{
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...>& SoAIterator<Fields...>::operator++()
+{
+    ++index;
+    return *this;
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...> SoAIterator<Fields...>::operator++(int)
+{
+    SoAIterator<Fields...> temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...>& SoAIterator<Fields...>::operator--()
+{
+    --index;
+    return *this;
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...> SoAIterator<Fields...>::operator--(int)
+{
+    SoAIterator<Fields...> temp = *this;
+    --(*this);
+    return temp;
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...>& SoAIterator<Fields...>::operator+=(Offset offset)
+{
+    index = static_cast<std::size_t>(static_cast<Offset>(index) + offset);
+    return *this;
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...>& SoAIterator<Fields...>::operator-=(Offset offset)
+{
+    index = static_cast<std::size_t>(static_cast<Offset>(index) - offset);
+    return *this;
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...> SoAIterator<Fields...>::operator+(Offset offset) const
+{
+    SoAIterator<Fields...> temp = *this;
+    temp += offset;
+    return temp;
+}
+
+template <typename... Fields>
+inline SoAIterator<Fields...> SoAIterator<Fields...>::operator-(Offset offset) const
+{
+    SoAIterator<Fields...> temp = *this;
+    temp -= offset;
+    return temp;
+}
+
+template <typename... Fields>
+inline typename SoAIterator<Fields...>::Offset SoAIterator<Fields...>::operator-(const SoAIterator<Fields...>& other) const
+{
+    return static_cast<Offset>(index) - static_cast<Offset>(other.index);
+}
+
+template <typename... Fields>
+inline typename SoAIterator<Fields...>::Ref SoAIterator<Fields...>::operator*() const noexcept
+{
+    return row(index, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+inline typename SoAIterator<Fields...>::Ref SoAIterator<Fields...>::operator[](Offset offset) const noexcept
+{
+    return row(static_cast<std::size_t>(static_cast<Offset>(index) + offset), std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+inline bool SoAIterator<Fields...>::operator==(const SoAIterator<Fields...>& other) const
+{
+    return index == other.index;
+}
+
+template <typename... Fields>
+inline bool SoAIterator<Fields...>::operator!=(const SoAIterator<Fields...>& other) const
+{
+    return index != other.index;
+}
+
+template <typename... Fields>
+inline bool SoAIterator<Fields...>::operator<(const SoAIterator<Fields...>& other) const
+{
+    return index < other.index;
+}
+
+template <typename... Fields>
+inline bool SoAIterator<Fields...>::operator>(const SoAIterator<Fields...>& other) const
+{
+    return index > other.index;
+}
+
+template <typename... Fields>
+inline bool SoAIterator<Fields...>::operator<=(const SoAIterator<Fields...>& other) const
+{
+    return index <= other.index;
+}
+
+template <typename... Fields>
+inline bool SoAIterator<Fields...>::operator>=(const SoAIterator<Fields...>& other) const
+{
+    return index >= other.index;
+}
+
+template <typename... Fields>
+template <std::size_t... I>
+inline typename SoAIterator<Fields...>::Ref SoAIterator<Fields...>::row(std::size_t idx, std::index_sequence<I...>) const noexcept
+{
+    return Ref(std::get<I>(ptrs)[idx]...);
+}
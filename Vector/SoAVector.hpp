@@ -0,0 +1,433 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <type_traits>
+
+#include "SoAIterator.hpp"
+#include "../Span/Span.hpp"
+
+template <typename T, typename Allocator = std::allocator<T>>
+class SoAVector;
+
+template <typename... Fields, typename Allocator>
+class SoAVector<std::tuple<Fields...>, Allocator>
+{
+private:
+    static constexpr std::size_t GROWTH_FACTOR = 2;
+
+    template <std::size_t I>
+    using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    template <typename U>
+    using FieldAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+    using Indices = std::index_sequence_for<Fields...>;
+
+    std::tuple<Fields*...> data;
+    std::size_t size;
+    std::size_t capacity;
+
+    std::tuple<FieldAllocator<Fields>...> allocators;
+
+public:
+    using Row = std::tuple<Fields&...>;
+    using ConstRow = std::tuple<const Fields&...>;
+
+    using Iterator = SoAIterator<Fields...>;
+    using ConstIterator = SoAIterator<const Fields...>;
+
+    Iterator begin()
+    {
+        return Iterator(data, 0);
+    }
+
+    Iterator end()
+    {
+        return Iterator(data, size);
+    }
+
+    ConstIterator cbegin() const
+    {
+        return ConstIterator(data, 0);
+    }
+
+    ConstIterator cend() const
+    {
+        return ConstIterator(data, size);
+    }
+
+public:
+    SoAVector();
+    explicit SoAVector(std::size_t n);
+
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+
+    bool isEmpty() const;
+
+    template <std::size_t I>
+    Span<Field<I>> getField();
+
+    template <std::size_t I>
+    Span<const Field<I>> getField() const;
+
+    Row front();
+    ConstRow front() const;
+
+    Row back();
+    ConstRow back() const;
+
+    Row operator[](std::size_t idx);
+    ConstRow operator[](std::size_t idx) const;
+
+    SoAVector<std::tuple<Fields...>, Allocator>& push_back(const Fields&... vals);
+    SoAVector<std::tuple<Fields...>, Allocator>& push_back(Fields&&... vals);
+
+    SoAVector<std::tuple<Fields...>, Allocator>& pop_back();
+
+    SoAVector<std::tuple<Fields...>, Allocator>& reserve(std::size_t n);
+    SoAVector<std::tuple<Fields...>, Allocator>& clear();
+
+    SoAVector(const SoAVector<std::tuple<Fields...>, Allocator>& other);
+    SoAVector<std::tuple<Fields...>, Allocator>& operator=(const SoAVector<std::tuple<Fields...>, Allocator>& other);
+
+    SoAVector(SoAVector<std::tuple<Fields...>, Allocator>&& other) noexcept;
+    SoAVector<std::tuple<Fields...>, Allocator>& operator=(SoAVector<std::tuple<Fields...>, Allocator>&& other) noexcept;
+
+    ~SoAVector() noexcept;
+
+private:
+    template <std::size_t... I>
+    Row row(std::size_t idx, std::index_sequence<I...>);
+
+    template <std::size_t... I>
+    ConstRow row(std::size_t idx, std::index_sequence<I...>) const;
+
+    template <typename F, std::size_t... I>
+    static void forEachField(F&& func, std::index_sequence<I...>);
+
+    void resize(std::size_t n);
+    std::size_t calculateCapacity() const;
+
+    void destroyFrom(std::size_t idx) noexcept;
+
+    void copyFrom(const SoAVector<std::tuple<Fields...>, Allocator>& other);
+    void moveFrom(SoAVector<std::tuple<Fields...>, Allocator>&& other) noexcept;
+    void free() noexcept;
+};
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>::SoAVector() : data(), size(0), capacity(0)
+{
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>::SoAVector(std::size_t n) : data(), size(0), capacity(0)
+{
+    reserve(n);
+
+    forEachField([&](auto field)
+    {
+        constexpr std::size_t I = decltype(field)::value;
+        using AllocatorT = std::allocator_traits<FieldAllocator<Field<I>>>;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            AllocatorT::construct(std::get<I>(allocators), &std::get<I>(data)[i]);
+        }
+    }, Indices{});
+
+    size = n;
+}
+
+template <typename... Fields, typename Allocator>
+inline std::size_t SoAVector<std::tuple<Fields...>, Allocator>::getSize() const
+{
+    return size;
+}
+
+template <typename... Fields, typename Allocator>
+inline std::size_t SoAVector<std::tuple<Fields...>, Allocator>::getCapacity() const
+{
+    return capacity;
+}
+
+template <typename... Fields, typename Allocator>
+inline bool SoAVector<std::tuple<Fields...>, Allocator>::isEmpty() const
+{
+    return size == 0;
+}
+
+template <typename... Fields, typename Allocator>
+template <std::size_t I>
+inline Span<typename SoAVector<std::tuple<Fields...>, Allocator>::template Field<I>> SoAVector<std::tuple<Fields...>, Allocator>::getField()
+{
+    return Span<Field<I>>(std::get<I>(data), size);
+}
+
+template <typename... Fields, typename Allocator>
+template <std::size_t I>
+inline Span<const typename SoAVector<std::tuple<Fields...>, Allocator>::template Field<I>> SoAVector<std::tuple<Fields...>, Allocator>::getField() const
+{
+    return Span<const Field<I>>(std::get<I>(data), size);
+}
+
+template <typename... Fields, typename Allocator>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::Row SoAVector<std::tuple<Fields...>, Allocator>::front()
+{
+    return row(0, Indices{});
+}
+
+template <typename... Fields, typename Allocator>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::ConstRow SoAVector<std::tuple<Fields...>, Allocator>::front() const
+{
+    return row(0, Indices{});
+}
+
+template <typename... Fields, typename Allocator>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::Row SoAVector<std::tuple<Fields...>, Allocator>::back()
+{
+    return row(size - 1, Indices{});
+}
+
+template <typename... Fields, typename Allocator>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::ConstRow SoAVector<std::tuple<Fields...>, Allocator>::back() const
+{
+    return row(size - 1, Indices{});
+}
+
+template <typename... Fields, typename Allocator>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::Row SoAVector<std::tuple<Fields...>, Allocator>::operator[](std::size_t idx)
+{
+    return row(idx, Indices{});
+}
+
+template <typename... Fields, typename Allocator>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::ConstRow SoAVector<std::tuple<Fields...>, Allocator>::operator[](std::size_t idx) const
+{
+    return row(idx, Indices{});
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>& SoAVector<std::tuple<Fields...>, Allocator>::push_back(const Fields&... vals)
+{
+    if (size >= capacity) resize(calculateCapacity());
+
+    std::tuple<const Fields&...> values(vals...);
+    forEachField([&](auto field)
+    {
+        constexpr std::size_t I = decltype(field)::value;
+        using AllocatorT = std::allocator_traits<FieldAllocator<Field<I>>>;
+
+        AllocatorT::construct(std::get<I>(allocators), &std::get<I>(data)[size], std::get<I>(values));
+    }, Indices{});
+
+    size++;
+    return *this;
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>& SoAVector<std::tuple<Fields...>, Allocator>::push_back(Fields&&... vals)
+{
+    if (size >= capacity) resize(calculateCapacity());
+
+    std::tuple<Fields&&...> values(std::move(vals)...);
+    forEachField([&](auto field)
+    {
+        constexpr std::size_t I = decltype(field)::value;
+        using AllocatorT = std::allocator_traits<FieldAllocator<Field<I>>>;
+
+        AllocatorT::construct(std::get<I>(allocators), &std::get<I>(data)[size], std::get<I>(std::move(values)));
+    }, Indices{});
+
+    size++;
+    return *this;
+}
+
+template <typename... Fields, typename Allocator>
+inline SoAVector<std::tuple<Fields...>, Allocator>& SoAVector<std::tuple<Fields...>, Allocator>::pop_back()
+{
+    if (isEmpty()) return *this;
+
+    destroyFrom(size - 1);
+    return *this;
+}
+
+template <typename... Fields, typename Allocator>
+inline SoAVector<std::tuple<Fields...>, Allocator>& SoAVector<std::tuple<Fields...>, Allocator>::reserve(std::size_t n)
+{
+    if (n > capacity) resize(n);
+    return *this;
+}
+
+template <typename... Fields, typename Allocator>
+inline SoAVector<std::tuple<Fields...>, Allocator>& SoAVector<std::tuple<Fields...>, Allocator>::clear()
+{
+    destroyFrom(0);
+    return *this;
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>::SoAVector(const SoAVector<std::tuple<Fields...>, Allocator>& other)
+{
+    copyFrom(other);
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>& SoAVector<std::tuple<Fields...>, Allocator>::operator=(const SoAVector<std::tuple<Fields...>, Allocator>& other)
+{
+    if (this != &other)
+    {
+        free();
+        copyFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>::SoAVector(SoAVector<std::tuple<Fields...>, Allocator>&& other) noexcept
+{
+    moveFrom(std::move(other));
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>& SoAVector<std::tuple<Fields...>, Allocator>::operator=(SoAVector<std::tuple<Fields...>, Allocator>&& other) noexcept
+{
+    if (this != &other)
+    {
+        free();
+        moveFrom(std::move(other));
+    }
+
+    return *this;
+}
+
+template <typename... Fields, typename Allocator>
+SoAVector<std::tuple<Fields...>, Allocator>::~SoAVector() noexcept
+{
+    free();
+}
+
+template <typename... Fields, typename Allocator>
+template <std::size_t... I>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::Row SoAVector<std::tuple<Fields...>, Allocator>::row(std::size_t idx, std::index_sequence<I...>)
+{
+    return Row(std::get<I>(data)[idx]...);
+}
+
+template <typename... Fields, typename Allocator>
+template <std::size_t... I>
+inline typename SoAVector<std::tuple<Fields...>, Allocator>::ConstRow SoAVector<std::tuple<Fields...>, Allocator>::row(std::size_t idx, std::index_sequence<I...>) const
+{
+    return ConstRow(std::get<I>(data)[idx]...);
+}
+
+template <typename... Fields, typename Allocator>
+template <typename F, std::size_t... I>
+inline void SoAVector<std::tuple<Fields...>, Allocator>::forEachField(F&& func, std::index_sequence<I...>)
+{
+    (func(std::integral_constant<std::size_t, I>{}), ...);
+}
+
+template <typename... Fields, typename Allocator>
+inline void SoAVector<std::tuple<Fields...>, Allocator>::resize(std::size_t n)
+{
+    if (n == 0) n = 1;
+
+    forEachField([&](auto field)
+    {
+        constexpr std::size_t I = decltype(field)::value;
+        using AllocatorT = std::allocator_traits<FieldAllocator<Field<I>>>;
+
+        auto& allocator = std::get<I>(allocators);
+        Field<I>*& fieldData = std::get<I>(data);
+
+        Field<I>* newData = allocator.allocate(n);
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            AllocatorT::construct(allocator, &newData[i], std::move(fieldData[i]));
+            AllocatorT::destroy(allocator, &fieldData[i]);
+        }
+
+        if (fieldData) allocator.deallocate(fieldData, capacity);
+        fieldData = newData;
+    }, Indices{});
+
+    capacity = n;
+}
+
+template <typename... Fields, typename Allocator>
+inline std::size_t SoAVector<std::tuple<Fields...>, Allocator>::calculateCapacity() const
+{
+    return capacity ? capacity * GROWTH_FACTOR : 1;
+}
+
+template <typename... Fields, typename Allocator>
+inline void SoAVector<std::tuple<Fields...>, Allocator>::destroyFrom(std::size_t idx) noexcept
+{
+    forEachField([&](auto field)
+    {
+        constexpr std::size_t I = decltype(field)::value;
+        using AllocatorT = std::allocator_traits<FieldAllocator<Field<I>>>;
+
+        for (std::size_t i = idx; i < size; i++)
+        {
+            AllocatorT::destroy(std::get<I>(allocators), &std::get<I>(data)[i]);
+        }
+    }, Indices{});
+
+    size = idx;
+}
+
+template <typename... Fields, typename Allocator>
+inline void SoAVector<std::tuple<Fields...>, Allocator>::copyFrom(const SoAVector<std::tuple<Fields...>, Allocator>& other)
+{
+    data = std::tuple<Fields*...>();
+    size = 0;
+    capacity = 0;
+
+    if (other.capacity) resize(other.capacity);
+
+    forEachField([&](auto field)
+    {
+        constexpr std::size_t I = decltype(field)::value;
+        using AllocatorT = std::allocator_traits<FieldAllocator<Field<I>>>;
+
+        for (std::size_t i = 0; i < other.size; i++)
+        {
+            AllocatorT::construct(std::get<I>(allocators), &std::get<I>(data)[i], std::get<I>(other.data)[i]);
+        }
+    }, Indices{});
+
+    size = other.size;
+}
+
+template <typename... Fields, typename Allocator>
+inline void SoAVector<std::tuple<Fields...>, Allocator>::moveFrom(SoAVector<std::tuple<Fields...>, Allocator>&& other) noexcept
+{
+    data = std::exchange(other.data, std::tuple<Fields*...>());
+    size = std::exchange(other.size, 0);
+    capacity = std::exchange(other.capacity, 0);
+}
+
+template <typename... Fields, typename Allocator>
+inline void SoAVector<std::tuple<Fields...>, Allocator>::free() noexcept
+{
+    destroyFrom(0);
+
+    forEachField([&](auto field)
+    {
+        constexpr std::size_t I = decltype(field)::value;
+
+        Field<I>*& fieldData = std::get<I>(data);
+        if (fieldData) std::get<I>(allocators).deallocate(fieldData, capacity);
+        fieldData = nullptr;
+    }, Indices{});
+
+    capacity = 0;
+}
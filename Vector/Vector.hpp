@@ -74,6 +74,8 @@ public:
     template <typename... Args>
     Vector<T, Allocator>& emplace_back(Args&&... args);
 
+    Vector<T, Allocator>& reserve(std::size_t n);
+
     Vector<T, Allocator>& insert(const Iterator& pos, const T& val);
     Vector<T, Allocator>& insert(const Iterator& pos, T&& val);
 
@@ -132,7 +134,7 @@ inline std::size_t Vector<T, Allocator>::getSize() const
 template <typename T, typename Allocator>
 inline std::size_t Vector<T, Allocator>::getCapacity() const
 {
-    return size;
+    return capacity;
 }
 
 template <typename T, typename Allocator>
@@ -200,7 +202,7 @@ inline Vector<T, Allocator>& Vector<T, Allocator>::pop_back()
 
     AllocatorT::destroy(allocator, &data[--size]);
 
-    if (size * 4 >= capacity && capacity > 1) resize(calculateCapacity(false));
+    if (size * 4 <= capacity && capacity > 1) resize(calculateCapacity(false));
 
     return *this;
 }
@@ -214,6 +216,13 @@ inline Vector<T, Allocator>& Vector<T, Allocator>::emplace_back(Args&&... args)
     return *this;
 }
 
+template <typename T, typename Allocator>
+inline Vector<T, Allocator>& Vector<T, Allocator>::reserve(std::size_t n)
+{
+    if (n > capacity) resize(n);
+    return *this;
+}
+
 template <typename T, typename Allocator>
 Vector<T, Allocator>& Vector<T, Allocator>::insert(const Iterator& pos, const T& val)
 {
@@ -336,7 +345,7 @@ inline void Vector<T, Allocator>::resize(std::size_t n)
         AllocatorT::destroy(allocator, &data[i]);
     }
 
-    allocator.deallocate(data, capacity);
+    if (data) allocator.deallocate(data, capacity);
     data = newData;
     capacity = n;
 }
@@ -379,7 +388,7 @@ inline void Vector<T, Allocator>::free() noexcept
         AllocatorT::destroy(allocator, &data[i]);
     }
 
-    allocator.deallocate(data, capacity);
+    if (data) allocator.deallocate(data, capacity);
 
     data = nullptr;
     size = capacity = 0;
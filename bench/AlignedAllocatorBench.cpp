@@ -0,0 +1,59 @@
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "../Vector/Vector.hpp"
+#include "../Allocator/AlignedAllocator.hpp"
+
+#include "Bench.hpp"
+
+template <typename Allocator>
+static void randomReads(const char* name, std::size_t n, std::size_t reads, std::size_t runs)
+{
+    try
+    {
+        Vector<std::uint64_t, Allocator> values(n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            values[i] = i;
+        }
+
+        double seconds = Bench::measure(runs, [&]()
+        {
+            std::uint64_t state = 88172645463325252ull;
+            std::uint64_t sum = 0;
+
+            for (std::size_t i = 0; i < reads; i++)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                sum += values[static_cast<std::size_t>(state % n)];
+            }
+
+            Bench::consume(sum);
+        });
+
+        Bench::report(name, seconds, static_cast<double>(reads), "reads");
+    }
+    catch (const std::bad_alloc&)
+    {
+        std::printf("%-48s unavailable\n", name);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 25);
+    std::size_t reads = Bench::argument(argc, argv, 2, std::size_t(1) << 24);
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    randomReads<std::allocator<std::uint64_t>>("std::allocator", n, reads, runs);
+    randomReads<AlignedAllocator<std::uint64_t, 64, HugePages::None>>("AlignedAllocator 4K pages", n, reads, runs);
+    randomReads<AlignedAllocator<std::uint64_t, 64, HugePages::Transparent>>("AlignedAllocator transparent huge pages", n, reads, runs);
+    randomReads<AlignedAllocator<std::uint64_t, 64, HugePages::Explicit>>("AlignedAllocator explicit huge pages", n, reads, runs);
+
+    return 0;
+}
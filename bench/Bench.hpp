@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "../Utility/Hardware.hpp"
+
+namespace Bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    inline double since(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    template <typename F>
+    double measure(std::size_t runs, F&& func)
+    {
+        double best = 0;
+
+        for (std::size_t run = 0; run < runs; run++)
+        {
+            Clock::time_point start = Clock::now();
+            func();
+
+            double elapsed = since(start);
+            if (run == 0 || elapsed < best) best = elapsed;
+        }
+
+        return best;
+    }
+
+    inline std::size_t argument(int argc, char** argv, int idx, std::size_t fallback)
+    {
+        if (argc <= idx) return fallback;
+        return static_cast<std::size_t>(std::strtoull(argv[idx], nullptr, 10));
+    }
+
+    inline void consume(std::uint64_t val)
+    {
+        static volatile std::uint64_t sink = 0;
+        sink = sink + val;
+    }
+
+    inline void pin(std::size_t cpu)
+    {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu % std::max<unsigned>(1, std::thread::hardware_concurrency()), &set);
+
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)cpu;
+#endif
+    }
+
+    inline void backoff(std::size_t& spins)
+    {
+        if (++spins % 64 == 0) std::this_thread::yield();
+        else Hardware::pause();
+    }
+
+    inline void report(const char* name, double seconds, double items, const char* unit)
+    {
+        std::printf("%-48s %10.3f ms %12.2f M%s/s\n", name, seconds * 1e3, items / seconds / 1e6, unit);
+    }
+}
@@ -0,0 +1,48 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+#include "../Deque/Deque.hpp"
+#include "../Deque/BlockDeque.hpp"
+
+#include "Bench.hpp"
+
+template <typename Container>
+static void pushLatency(const char* name, std::size_t n)
+{
+    std::vector<std::uint32_t> latencies(n);
+    Container container;
+
+    Bench::Clock::time_point begin = Bench::Clock::now();
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        Bench::Clock::time_point start = Bench::Clock::now();
+        container.push_back(static_cast<std::uint64_t>(i));
+
+        std::chrono::nanoseconds elapsed = Bench::Clock::now() - start;
+        latencies[i] = static_cast<std::uint32_t>(std::min<std::int64_t>(elapsed.count(), UINT32_MAX));
+    }
+
+    double total = Bench::since(begin);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    std::printf("%-32s total %9.3f ms  p50 %6u ns  p99.99 %8u ns  max %10u ns\n",
+        name, total * 1e3, latencies[n / 2], latencies[n - 1 - n / 10000], latencies[n - 1]);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 25);
+
+    pushLatency<Deque<std::uint64_t>>("Deque push_back", n);
+    pushLatency<BlockDeque<std::uint64_t>>("BlockDeque push_back", n);
+    pushLatency<std::deque<std::uint64_t>>("std::deque push_back", n);
+
+    return 0;
+}
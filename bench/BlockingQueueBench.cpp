@@ -0,0 +1,133 @@
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Queue/BlockingQueue.hpp"
+#include "../Queue/Queue.hpp"
+
+#include "Bench.hpp"
+
+template <typename Produce, typename Consume>
+static double run(std::size_t producers, std::size_t messages, Produce produce, Consume consume)
+{
+    std::vector<std::thread> threads;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    for (std::size_t p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&produce, p, producers, messages]()
+        {
+            Bench::pin(p + 1);
+
+            for (std::size_t i = 0; i < messages / producers; i++)
+            {
+                produce(static_cast<std::uint64_t>(i));
+            }
+        });
+    }
+
+    Bench::pin(0);
+    Bench::consume(consume(messages / producers * producers));
+
+    for (std::thread& thread : threads) thread.join();
+
+    return Bench::since(start);
+}
+
+static double blockingPop(std::size_t producers, std::size_t messages)
+{
+    BlockingQueue<std::uint64_t> queue;
+
+    return run(producers, messages, [&queue](std::uint64_t val) { queue.push(val); }, [&queue](std::size_t total)
+    {
+        std::uint64_t sum = 0;
+        std::uint64_t val = 0;
+
+        for (std::size_t received = 0; received < total; received++)
+        {
+            queue.pop(val);
+            sum += val;
+        }
+
+        return sum;
+    });
+}
+
+static double blockingDrain(std::size_t producers, std::size_t messages, std::size_t batch)
+{
+    BlockingQueue<std::uint64_t> queue;
+
+    return run(producers, messages, [&queue](std::uint64_t val) { queue.push(val); }, [&queue, batch](std::size_t total)
+    {
+        std::vector<std::uint64_t> buffer;
+        buffer.reserve(batch);
+
+        std::uint64_t sum = 0;
+
+        for (std::size_t received = 0; received < total;)
+        {
+            buffer.clear();
+            received += queue.drain(std::back_inserter(buffer), batch);
+
+            for (std::uint64_t val : buffer) sum += val;
+        }
+
+        return sum;
+    });
+}
+
+static double mutexQueue(std::size_t producers, std::size_t messages)
+{
+    Queue<std::uint64_t> queue;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    auto produce = [&](std::uint64_t val)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push(val);
+        }
+
+        condition.notify_one();
+    };
+
+    return run(producers, messages, produce, [&](std::size_t total)
+    {
+        std::uint64_t sum = 0;
+
+        for (std::size_t received = 0; received < total; received++)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&queue]() { return !queue.isEmpty(); });
+
+            sum += queue.front();
+            queue.pop();
+        }
+
+        return sum;
+    });
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t messages = Bench::argument(argc, argv, 1, std::size_t(1) << 22);
+    std::size_t counts[] = { 1, 2, 4, 8 };
+
+    for (std::size_t producers : counts)
+    {
+        std::string suffix = " " + std::to_string(producers) + "P:1C";
+
+        Bench::report(("BlockingQueue pop" + suffix).c_str(), blockingPop(producers, messages), static_cast<double>(messages), "msgs");
+        Bench::report(("BlockingQueue drain (batch 64)" + suffix).c_str(), blockingDrain(producers, messages, 64), static_cast<double>(messages), "msgs");
+        Bench::report(("mutex + condvar + Queue" + suffix).c_str(), mutexQueue(producers, messages), static_cast<double>(messages), "msgs");
+    }
+
+    return 0;
+}
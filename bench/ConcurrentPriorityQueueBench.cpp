@@ -0,0 +1,135 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../PriorityQueue/ConcurrentPriorityQueue.hpp"
+#include "../PriorityQueue/PriorityQueue.hpp"
+
+#include "Bench.hpp"
+
+using Relaxed = ConcurrentPriorityQueue<std::uint64_t, std::greater<std::uint64_t>>;
+
+struct Locked
+{
+    std::mutex mutex;
+    PriorityQueue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>, 4> heap;
+
+    void push(std::uint64_t val)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        heap.push(val);
+    }
+
+    bool try_pop(std::uint64_t& out)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (heap.empty()) return false;
+
+        heap.pop(out);
+        return true;
+    }
+};
+
+static std::uint64_t next(std::uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state;
+}
+
+template <typename Q>
+static double hold(Q& queue, std::size_t threads, std::size_t prefill, std::size_t operations)
+{
+    std::uint64_t seed = 2463534242ull;
+    for (std::size_t i = 0; i < prefill; i++) queue.push(next(seed) >> 24);
+
+    std::vector<std::thread> workers;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    for (std::size_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&queue, t, threads, operations]()
+        {
+            Bench::pin(t);
+
+            std::uint64_t state = 88172645463325252ull + t;
+            std::uint64_t val = 0;
+
+            for (std::size_t i = 0; i < operations / threads; i++)
+            {
+                if (!queue.try_pop(val)) val = 0;
+                queue.push(val + (next(state) >> 44));
+            }
+        });
+    }
+
+    for (std::thread& worker : workers) worker.join();
+
+    return Bench::since(start);
+}
+
+static double rankError(std::size_t threads, std::size_t n)
+{
+    Relaxed queue(threads);
+
+    std::vector<std::uint64_t> keys(n);
+    for (std::size_t i = 0; i < n; i++) keys[i] = i;
+
+    std::uint64_t state = 2463534242ull;
+    for (std::size_t i = n; i > 1; i--) std::swap(keys[i - 1], keys[next(state) % i]);
+
+    for (std::uint64_t key : keys) queue.push(key);
+
+    std::vector<std::uint32_t> tree(n + 1);
+    for (std::size_t i = 1; i <= n; i++)
+    {
+        tree[i]++;
+        if (i + (i & (0 - i)) <= n) tree[i + (i & (0 - i))] += tree[i];
+    }
+
+    double total = 0;
+    std::uint64_t val = 0;
+
+    while (queue.try_pop(val))
+    {
+        std::size_t smaller = 0;
+        for (std::size_t i = static_cast<std::size_t>(val); i > 0; i -= i & (0 - i)) smaller += tree[i];
+
+        total += static_cast<double>(smaller);
+
+        for (std::size_t i = static_cast<std::size_t>(val) + 1; i <= n; i += i & (0 - i)) tree[i]--;
+    }
+
+    return total / static_cast<double>(n);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t prefill = Bench::argument(argc, argv, 1, std::size_t(1) << 16);
+    std::size_t operations = Bench::argument(argc, argv, 2, std::size_t(1) << 22);
+    std::size_t quality = Bench::argument(argc, argv, 3, std::size_t(1) << 18);
+    std::size_t counts[] = { 1, 2, 4, 8 };
+
+    for (std::size_t threads : counts)
+    {
+        std::string suffix = " (" + std::to_string(threads) + (threads == 1 ? " thread)" : " threads)");
+
+        Relaxed relaxed(threads);
+        Locked locked;
+
+        Bench::report(("ConcurrentPriorityQueue hold" + suffix).c_str(), hold(relaxed, threads, prefill, operations), static_cast<double>(operations), "ops");
+        Bench::report(("mutex + PriorityQueue hold" + suffix).c_str(), hold(locked, threads, prefill, operations), static_cast<double>(operations), "ops");
+
+        std::printf("%-48s %10.1f mean rank error\n", ("ConcurrentPriorityQueue quality" + suffix).c_str(), rankError(threads, quality));
+    }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "../Deque/Deque.hpp"
+
+#include "Bench.hpp"
+
+int main(int argc, char** argv)
+{
+    std::size_t total = Bench::argument(argc, argv, 1, std::size_t(1) << 30);
+    std::size_t chunk = Bench::argument(argc, argv, 2, 1500);
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    std::vector<std::uint8_t> packet(chunk);
+    std::vector<std::uint8_t> sink(chunk);
+
+    for (std::size_t i = 0; i < chunk; i++)
+    {
+        packet[i] = static_cast<std::uint8_t>(i);
+    }
+
+    std::size_t rounds = total / chunk;
+    double bytes = static_cast<double>(rounds * chunk);
+
+    double single = Bench::measure(runs, [&]()
+    {
+        Deque<std::uint8_t> buffer;
+        buffer.reserve(4 * chunk);
+
+        std::uint64_t sum = 0;
+
+        for (std::size_t r = 0; r < rounds; r++)
+        {
+            for (std::size_t i = 0; i < chunk; i++)
+            {
+                buffer.push_back(packet[i]);
+            }
+
+            for (std::size_t i = 0; i < chunk; i++)
+            {
+                sink[i] = buffer.front();
+                buffer.pop_front();
+            }
+
+            sum += sink[r % chunk];
+        }
+
+        Bench::consume(sum);
+    });
+
+    double bulk = Bench::measure(runs, [&]()
+    {
+        Deque<std::uint8_t> buffer;
+        buffer.reserve(4 * chunk);
+
+        std::uint64_t sum = 0;
+
+        for (std::size_t r = 0; r < rounds; r++)
+        {
+            buffer.push_back(packet.begin(), packet.end());
+
+            std::pair<Span<std::uint8_t>, Span<std::uint8_t>> segments = buffer.getSegments();
+            std::memcpy(sink.data(), segments.first.getData(), segments.first.getSize());
+            std::memcpy(sink.data() + segments.first.getSize(), segments.second.getData(), segments.second.getSize());
+
+            buffer.pop_front(chunk);
+            sum += sink[r % chunk];
+        }
+
+        Bench::consume(sum);
+    });
+
+    double spans = Bench::measure(runs, [&]()
+    {
+        Deque<std::uint8_t> buffer;
+        buffer.reserve(4 * chunk);
+
+        std::uint64_t sum = 0;
+
+        for (std::size_t r = 0; r < rounds; r++)
+        {
+            std::pair<Span<std::uint8_t>, Span<std::uint8_t>> free = buffer.getFreeSegments();
+
+            std::size_t first = std::min(chunk, free.first.getSize());
+            std::memcpy(free.first.getData(), packet.data(), first);
+            std::memcpy(free.second.getData(), packet.data() + first, chunk - first);
+            buffer.commit_back(chunk);
+
+            std::pair<Span<std::uint8_t>, Span<std::uint8_t>> segments = buffer.getSegments();
+            std::memcpy(sink.data(), segments.first.getData(), segments.first.getSize());
+            std::memcpy(sink.data() + segments.first.getSize(), segments.second.getData(), segments.second.getSize());
+
+            buffer.pop_front(chunk);
+            sum += sink[r % chunk];
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::report("per-byte push_back/pop_front", single, bytes, "B");
+    Bench::report("push_back(range) + segments + pop_front(n)", bulk, bytes, "B");
+    Bench::report("free segments + commit_back + pop_front(n)", spans, bytes, "B");
+
+    return 0;
+}
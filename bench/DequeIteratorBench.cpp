@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#include "../Deque/Deque.hpp"
+
+#include "Bench.hpp"
+
+template <typename Container>
+static void refill(Container& container, std::size_t n)
+{
+    std::uint64_t state = 2463534242ull;
+
+    while (container.getSize() > 0) container.pop_front();
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        container.push_back(state);
+    }
+}
+
+static void refill(std::deque<std::uint64_t>& container, std::size_t n)
+{
+    std::uint64_t state = 2463534242ull;
+
+    container.clear();
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        container.push_back(state);
+    }
+}
+
+template <typename Container>
+static void sortAndScan(const char* sortName, const char* scanName, std::size_t n, std::size_t runs)
+{
+    Container container;
+
+    for (std::size_t i = 0; i < n / 2; i++)
+    {
+        container.push_back(0);
+        container.push_back(0);
+        container.pop_front();
+    }
+
+    double sort = 0;
+    for (std::size_t run = 0; run < runs; run++)
+    {
+        refill(container, n);
+
+        double elapsed = Bench::measure(1, [&]()
+        {
+            std::sort(container.begin(), container.end());
+        });
+
+        if (run == 0 || elapsed < sort) sort = elapsed;
+    }
+
+    double scan = Bench::measure(runs, [&]()
+    {
+        std::uint64_t sum = 0;
+
+        for (auto it = container.begin(); it != container.end(); ++it)
+        {
+            sum += *it;
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::report(sortName, sort, static_cast<double>(n), "elems");
+    Bench::report(scanName, scan, static_cast<double>(n), "elems");
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 22);
+    std::size_t runs = Bench::argument(argc, argv, 2, 3);
+
+    sortAndScan<Deque<std::uint64_t>>("Deque std::sort", "Deque iterator scan", n, runs);
+    sortAndScan<std::deque<std::uint64_t>>("std::deque std::sort", "std::deque iterator scan", n, runs);
+
+    return 0;
+}
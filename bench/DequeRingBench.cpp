@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#include "../Deque/Deque.hpp"
+
+#include "Bench.hpp"
+
+template <typename Container>
+static void fifo(const char* name, std::size_t window, std::size_t ops, std::size_t runs)
+{
+    double seconds = Bench::measure(runs, [&]()
+    {
+        Container container;
+        std::uint64_t sum = 0;
+
+        for (std::size_t i = 0; i < window; i++)
+        {
+            container.push_back(static_cast<std::uint64_t>(i));
+        }
+
+        for (std::size_t i = 0; i < ops; i++)
+        {
+            container.push_back(static_cast<std::uint64_t>(i));
+            sum += container.front();
+            container.pop_front();
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::report(name, seconds, static_cast<double>(ops), "ops");
+}
+
+template <typename Container>
+static void randomIndex(const char* name, std::size_t n, std::size_t reads, std::size_t runs)
+{
+    Container container;
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        container.push_back(static_cast<std::uint64_t>(i));
+    }
+
+    for (std::size_t i = 0; i < n / 2; i++)
+    {
+        container.pop_front();
+        container.push_back(static_cast<std::uint64_t>(i));
+    }
+
+    double seconds = Bench::measure(runs, [&]()
+    {
+        std::uint64_t state = 88172645463325252ull;
+        std::uint64_t sum = 0;
+
+        for (std::size_t i = 0; i < reads; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            sum += container[static_cast<std::size_t>(state % n)];
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::report(name, seconds, static_cast<double>(reads), "reads");
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t ops = Bench::argument(argc, argv, 1, std::size_t(1) << 25);
+    std::size_t runs = Bench::argument(argc, argv, 2, 3);
+
+    fifo<Deque<std::uint64_t>>("Deque push_back/pop_front (window 1000)", 1000, ops, runs);
+    fifo<std::deque<std::uint64_t>>("std::deque push_back/pop_front (window 1000)", 1000, ops, runs);
+
+    randomIndex<Deque<std::uint64_t>>("Deque random operator[] (1M elements)", std::size_t(1) << 20, ops, runs);
+    randomIndex<std::deque<std::uint64_t>>("std::deque random operator[] (1M elements)", std::size_t(1) << 20, ops, runs);
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "../PriorityQueue/IndexedPriorityQueue.hpp"
+#include "../PriorityQueue/PriorityQueue.hpp"
+
+#include "Bench.hpp"
+
+using Entry = std::pair<std::uint64_t, std::uint32_t>;
+
+struct Graph
+{
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> targets;
+    std::vector<std::uint32_t> weights;
+};
+
+static Graph randomGraph(std::size_t vertices, std::size_t degree)
+{
+    Graph graph;
+    graph.offsets.resize(vertices + 1);
+    graph.targets.reserve(vertices * degree);
+    graph.weights.reserve(vertices * degree);
+
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t v = 0; v < vertices; v++)
+    {
+        graph.offsets[v] = static_cast<std::uint32_t>(graph.targets.size());
+
+        for (std::size_t e = 0; e < degree; e++)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            graph.targets.push_back(static_cast<std::uint32_t>(state % vertices));
+            graph.weights.push_back(static_cast<std::uint32_t>((state >> 32) % 1000 + 1));
+        }
+    }
+
+    graph.offsets[vertices] = static_cast<std::uint32_t>(graph.targets.size());
+    return graph;
+}
+
+static std::uint64_t indexed(const Graph& graph, std::size_t& peak)
+{
+    using Heap = IndexedPriorityQueue<Entry, std::greater<Entry>>;
+
+    std::size_t vertices = graph.offsets.size() - 1;
+    if (vertices == 0) return 0;
+
+    std::vector<std::uint64_t> dist(vertices, std::numeric_limits<std::uint64_t>::max());
+    std::vector<Heap::Handle> handles(vertices);
+
+    Heap heap;
+    heap.reserve(vertices);
+
+    dist[0] = 0;
+    handles[0] = heap.push(Entry(0, 0));
+    peak = 1;
+
+    std::uint64_t total = 0;
+
+    while (!heap.empty())
+    {
+        Entry entry = heap.top();
+        heap.pop();
+
+        total += entry.first;
+
+        for (std::uint32_t e = graph.offsets[entry.second]; e < graph.offsets[entry.second + 1]; e++)
+        {
+            std::uint32_t target = graph.targets[e];
+            std::uint64_t candidate = entry.first + graph.weights[e];
+
+            if (candidate >= dist[target]) continue;
+
+            if (heap.contains(handles[target])) heap.update(handles[target], Entry(candidate, target));
+            else handles[target] = heap.push(Entry(candidate, target));
+
+            dist[target] = candidate;
+            if (heap.size() > peak) peak = heap.size();
+        }
+    }
+
+    return total;
+}
+
+static std::uint64_t lazy(const Graph& graph, std::size_t& peak)
+{
+    std::size_t vertices = graph.offsets.size() - 1;
+    if (vertices == 0) return 0;
+
+    std::vector<std::uint64_t> dist(vertices, std::numeric_limits<std::uint64_t>::max());
+
+    PriorityQueue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    heap.reserve(vertices);
+
+    dist[0] = 0;
+    heap.push(Entry(0, 0));
+    peak = 1;
+
+    std::uint64_t total = 0;
+
+    while (!heap.empty())
+    {
+        Entry entry;
+        heap.pop(entry);
+
+        if (entry.first != dist[entry.second]) continue;
+
+        total += entry.first;
+
+        for (std::uint32_t e = graph.offsets[entry.second]; e < graph.offsets[entry.second + 1]; e++)
+        {
+            std::uint32_t target = graph.targets[e];
+            std::uint64_t candidate = entry.first + graph.weights[e];
+
+            if (candidate >= dist[target]) continue;
+
+            heap.push(Entry(candidate, target));
+
+            dist[target] = candidate;
+            if (heap.size() > peak) peak = heap.size();
+        }
+    }
+
+    return total;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t vertices = Bench::argument(argc, argv, 1, std::size_t(1) << 20);
+    std::size_t degree = Bench::argument(argc, argv, 2, std::size_t(8));
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    Graph graph = randomGraph(vertices, degree);
+    double edges = static_cast<double>(graph.targets.size());
+
+    std::size_t indexedPeak = 0;
+    std::size_t lazyPeak = 0;
+    std::uint64_t indexedTotal = 0;
+    std::uint64_t lazyTotal = 0;
+
+    double indexedTime = Bench::measure(runs, [&]() { indexedTotal = indexed(graph, indexedPeak); });
+    double lazyTime = Bench::measure(runs, [&]() { lazyTotal = lazy(graph, lazyPeak); });
+
+    if (indexedTotal != lazyTotal)
+    {
+        std::fprintf(stderr, "distance mismatch: %llu != %llu\n", static_cast<unsigned long long>(indexedTotal), static_cast<unsigned long long>(lazyTotal));
+        return 1;
+    }
+
+    Bench::report("IndexedPriorityQueue decrease-key", indexedTime, edges, "edges");
+    Bench::report("PriorityQueue lazy deletion", lazyTime, edges, "edges");
+
+    std::printf("%-48s %10zu indexed %10zu lazy\n", "peak heap size", indexedPeak, lazyPeak);
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "../PriorityQueue/PriorityQueue.hpp"
+
+#include "Bench.hpp"
+
+template <std::size_t Arity>
+static double popHeavy(const std::vector<std::uint64_t>& keys, std::size_t pops, std::size_t runs)
+{
+    double best = 0;
+
+    for (std::size_t run = 0; run < runs; run++)
+    {
+        PriorityQueue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>, Arity> heap(keys.begin(), keys.end());
+
+        double elapsed = Bench::measure(1, [&]()
+        {
+            std::uint64_t sum = 0;
+
+            for (std::size_t i = 0; i < pops; i++)
+            {
+                sum += heap.top();
+                heap.pop();
+            }
+
+            Bench::consume(sum);
+        });
+
+        if (run == 0 || elapsed < best) best = elapsed;
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(10000000));
+    std::size_t pops = Bench::argument(argc, argv, 2, n / 2);
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    std::vector<std::uint64_t> keys(n);
+    std::uint64_t state = 2463534242ull;
+
+    for (std::uint64_t& key : keys)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        key = state;
+    }
+
+    double popped = static_cast<double>(pops);
+
+    Bench::report("PriorityQueue arity 2 pop", popHeavy<2>(keys, pops, runs), popped, "pops");
+    Bench::report("PriorityQueue arity 4 pop", popHeavy<4>(keys, pops, runs), popped, "pops");
+    Bench::report("PriorityQueue arity 8 pop", popHeavy<8>(keys, pops, runs), popped, "pops");
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "../PriorityQueue/PriorityQueue.hpp"
+
+#include "Bench.hpp"
+
+using Heap = PriorityQueue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>>;
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(10000000));
+    std::size_t batch = Bench::argument(argc, argv, 2, std::size_t(1) << 16);
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    std::vector<std::uint64_t> keys(n);
+    std::uint64_t state = 2463534242ull;
+
+    for (std::uint64_t& key : keys)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        key = state;
+    }
+
+    double items = static_cast<double>(n);
+
+    Bench::report("range constructor (heapify)", Bench::measure(runs, [&]()
+    {
+        Heap heap(keys.begin(), keys.end());
+        Bench::consume(heap.top());
+    }), items, "elems");
+
+    Bench::report("repeated push", Bench::measure(runs, [&]()
+    {
+        Heap heap;
+        for (std::uint64_t key : keys) heap.push(key);
+
+        Bench::consume(heap.top());
+    }), items, "elems");
+
+    Bench::report("reserve + repeated push", Bench::measure(runs, [&]()
+    {
+        Heap heap;
+        heap.reserve(n);
+
+        for (std::uint64_t key : keys) heap.push(key);
+
+        Bench::consume(heap.top());
+    }), items, "elems");
+
+    Bench::report("push_range in batches", Bench::measure(runs, [&]()
+    {
+        Heap heap;
+        heap.reserve(n);
+
+        for (std::size_t offset = 0; offset < n; offset += batch)
+        {
+            std::size_t count = std::min(batch, n - offset);
+            heap.push_range(keys.begin() + static_cast<std::ptrdiff_t>(offset), keys.begin() + static_cast<std::ptrdiff_t>(offset + count));
+        }
+
+        Bench::consume(heap.top());
+    }), items, "elems");
+
+    std::vector<std::uint64_t> scratch(n);
+
+    Bench::report("std::make_heap", Bench::measure(runs, [&]()
+    {
+        std::copy(keys.begin(), keys.end(), scratch.begin());
+        std::make_heap(scratch.begin(), scratch.end(), std::greater<std::uint64_t>());
+
+        Bench::consume(scratch.front());
+    }), items, "elems");
+
+    return 0;
+}
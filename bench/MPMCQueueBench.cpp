@@ -0,0 +1,70 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Queue/MPMCQueue.hpp"
+
+#include "Bench.hpp"
+
+static double contention(std::size_t producers, std::size_t consumers, std::size_t messages)
+{
+    MPMCQueue<std::uint64_t> queue(1024);
+    std::vector<std::thread> threads;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    for (std::size_t c = 0; c < consumers; c++)
+    {
+        threads.emplace_back([&queue, c, consumers, messages]()
+        {
+            Bench::pin(c);
+
+            std::uint64_t sum = 0;
+            std::uint64_t val = 0;
+
+            for (std::size_t i = 0; i < messages / consumers; i++)
+            {
+                queue.pop(val);
+                sum += val;
+            }
+
+            Bench::consume(sum);
+        });
+    }
+
+    for (std::size_t p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&queue, p, consumers, producers, messages]()
+        {
+            Bench::pin(consumers + p);
+
+            for (std::size_t i = 0; i < messages / producers; i++)
+            {
+                queue.push(static_cast<std::uint64_t>(i));
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) thread.join();
+
+    return Bench::since(start);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t messages = Bench::argument(argc, argv, 1, std::size_t(1) << 22);
+    std::size_t counts[] = { 1, 2, 4 };
+
+    for (std::size_t producers : counts)
+    {
+        for (std::size_t consumers : counts)
+        {
+            std::string name = "MPMCQueue " + std::to_string(producers) + "P:" + std::to_string(consumers) + "C";
+            Bench::report(name.c_str(), contention(producers, consumers, messages), static_cast<double>(messages), "msgs");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Queue/MPSCQueue.hpp"
+#include "../Queue/Queue.hpp"
+
+#include "Bench.hpp"
+
+static double mpscQueue(std::size_t producers, std::size_t messages)
+{
+    MPSCQueue<std::uint64_t> queue;
+    std::vector<std::thread> threads;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    for (std::size_t p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&queue, p, producers, messages]()
+        {
+            Bench::pin(p + 1);
+
+            for (std::size_t i = 0; i < messages / producers; i++)
+            {
+                queue.push(static_cast<std::uint64_t>(i));
+            }
+        });
+    }
+
+    Bench::pin(0);
+
+    std::uint64_t sum = 0;
+    std::uint64_t val = 0;
+    std::size_t spins = 0;
+
+    for (std::size_t received = 0; received < messages / producers * producers;)
+    {
+        if (queue.try_pop(val))
+        {
+            sum += val;
+            received++;
+        }
+        else
+        {
+            Bench::backoff(spins);
+        }
+    }
+
+    Bench::consume(sum);
+
+    for (std::thread& thread : threads) thread.join();
+
+    return Bench::since(start);
+}
+
+static double mutexQueue(std::size_t producers, std::size_t messages)
+{
+    Queue<std::uint64_t> queue;
+    std::mutex mutex;
+    std::vector<std::thread> threads;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    for (std::size_t p = 0; p < producers; p++)
+    {
+        threads.emplace_back([&queue, &mutex, p, producers, messages]()
+        {
+            Bench::pin(p + 1);
+
+            for (std::size_t i = 0; i < messages / producers; i++)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push(static_cast<std::uint64_t>(i));
+            }
+        });
+    }
+
+    Bench::pin(0);
+
+    std::uint64_t sum = 0;
+    std::size_t spins = 0;
+
+    for (std::size_t received = 0; received < messages / producers * producers;)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        if (queue.isEmpty())
+        {
+            lock.unlock();
+            Bench::backoff(spins);
+            continue;
+        }
+
+        sum += queue.front();
+        queue.pop();
+        received++;
+    }
+
+    Bench::consume(sum);
+
+    for (std::thread& thread : threads) thread.join();
+
+    return Bench::since(start);
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t messages = Bench::argument(argc, argv, 1, std::size_t(1) << 22);
+    std::size_t counts[] = { 1, 2, 4, 8 };
+
+    for (std::size_t producers : counts)
+    {
+        std::string suffix = " " + std::to_string(producers) + "P:1C";
+
+        Bench::report(("MPSCQueue" + suffix).c_str(), mpscQueue(producers, messages), static_cast<double>(messages), "msgs");
+        Bench::report(("mutex + Queue" + suffix).c_str(), mutexQueue(producers, messages), static_cast<double>(messages), "msgs");
+    }
+
+    return 0;
+}
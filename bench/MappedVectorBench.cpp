@@ -0,0 +1,106 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
+#include "../Vector/Vector.hpp"
+#include "../Vector/MappedVector.hpp"
+
+#include "Bench.hpp"
+
+struct Record
+{
+    std::uint64_t id;
+    double value;
+};
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 24);
+    std::size_t runs = Bench::argument(argc, argv, 2, 3);
+
+    std::string path = "MappedVectorBench.bin";
+
+    {
+        MappedVector<Record> records(path);
+        records.clear().reserve(n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            records.push_back(Record{ i, static_cast<double>(i) });
+        }
+    }
+
+    double bytes = static_cast<double>(n * sizeof(Record));
+
+    double readLoad = Bench::measure(runs, [&]()
+    {
+        Vector<Record> records;
+
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) return;
+
+        Record record;
+        while (std::fread(&record, sizeof(Record), 1, file) == 1)
+        {
+            records.push_back(record);
+        }
+
+        std::fclose(file);
+        Bench::consume(records.getSize());
+    });
+
+    double mapLoad = Bench::measure(runs, [&]()
+    {
+        MappedVector<Record> records(path);
+        Bench::consume(records.getSize());
+    });
+
+    double readScan = Bench::measure(runs, [&]()
+    {
+        Vector<Record> records;
+
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) return;
+
+        Record record;
+        while (std::fread(&record, sizeof(Record), 1, file) == 1)
+        {
+            records.push_back(record);
+        }
+
+        std::fclose(file);
+
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < records.getSize(); i++)
+        {
+            sum += records[i].id;
+        }
+
+        Bench::consume(sum);
+    });
+
+    double mapScan = Bench::measure(runs, [&]()
+    {
+        MappedVector<Record> records(path);
+
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < records.getSize(); i++)
+        {
+            sum += records[i].id;
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::report("fread + Vector::push_back load", readLoad, bytes, "B");
+    Bench::report("MappedVector open", mapLoad, bytes, "B");
+    Bench::report("fread + Vector::push_back load + scan", readScan, bytes, "B");
+    Bench::report("MappedVector open + scan", mapScan, bytes, "B");
+
+    ::unlink(path.c_str());
+
+    return 0;
+}
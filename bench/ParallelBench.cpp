@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <thread>
+
+#include "../Vector/Vector.hpp"
+#include "../Parallel/Algorithms.hpp"
+
+#include "Bench.hpp"
+
+static void fill(Vector<std::uint64_t>& values)
+{
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t i = 0; i < values.getSize(); i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        values[i] = state;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 24);
+    std::size_t maxThreads = Bench::argument(argc, argv, 2, std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    Vector<std::uint64_t> values(n);
+    Vector<std::uint64_t> output(n);
+
+    for (std::size_t threads = 1; threads <= maxThreads; threads++)
+    {
+        ThreadPool pool(threads > 1 ? threads - 1 : 1);
+
+        double sort = 0;
+        for (std::size_t run = 0; run < runs; run++)
+        {
+            fill(values);
+
+            double elapsed = Bench::measure(1, [&]()
+            {
+                if (threads == 1) std::sort(values.begin(), values.end());
+                else Parallel::sort(pool, values.begin(), values.end());
+            });
+
+            if (run == 0 || elapsed < sort) sort = elapsed;
+        }
+
+        double transform = Bench::measure(runs, [&]()
+        {
+            auto square = [](std::uint64_t val) { return val * val; };
+
+            if (threads == 1) std::transform(values.begin(), values.end(), output.begin(), square);
+            else Parallel::transform(pool, values.begin(), values.end(), output.begin(), square);
+        });
+
+        double reduce = Bench::measure(runs, [&]()
+        {
+            std::uint64_t sum = threads == 1
+                ? std::accumulate(values.begin(), values.end(), std::uint64_t(0))
+                : Parallel::reduce(pool, values.begin(), values.end(), std::uint64_t(0));
+
+            Bench::consume(sum);
+        });
+
+        std::string suffix = " (" + std::to_string(threads) + (threads == 1 ? " thread, serial)" : " threads)");
+
+        Bench::report(("sort" + suffix).c_str(), sort, static_cast<double>(n), "elems");
+        Bench::report(("transform" + suffix).c_str(), transform, static_cast<double>(n), "elems");
+        Bench::report(("reduce" + suffix).c_str(), reduce, static_cast<double>(n), "elems");
+    }
+
+    return 0;
+}
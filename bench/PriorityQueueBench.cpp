@@ -0,0 +1,111 @@
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include "../PriorityQueue/PriorityQueue.hpp"
+
+#include "Bench.hpp"
+
+struct Timer
+{
+    std::uint64_t deadline;
+    unsigned char payload[120];
+
+    Timer() : deadline(0), payload() { }
+    Timer(std::uint64_t when) : deadline(when), payload() { }
+
+    bool operator<(const Timer& other) const { return deadline < other.deadline; }
+    bool operator>(const Timer& other) const { return deadline > other.deadline; }
+};
+
+static std::uint64_t key(std::uint64_t val) { return val; }
+static std::uint64_t key(const Timer& val) { return val.deadline; }
+
+template <typename Heap, typename T>
+static double fillDrain(std::size_t n, std::size_t runs)
+{
+    return Bench::measure(runs, [&]()
+    {
+        Heap heap;
+        std::uint64_t state = 2463534242ull;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            heap.push(T(state));
+        }
+
+        std::uint64_t sum = 0;
+
+        while (!heap.empty())
+        {
+            sum += key(heap.top());
+            heap.pop();
+        }
+
+        Bench::consume(sum);
+    });
+}
+
+template <typename Heap, typename T>
+static double hold(std::size_t n, std::size_t operations, std::size_t runs)
+{
+    Heap heap;
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        heap.push(T(state >> 1));
+    }
+
+    return Bench::measure(runs, [&]()
+    {
+        for (std::size_t i = 0; i < operations; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            std::uint64_t now = key(heap.top());
+            heap.pop();
+            heap.push(T(now + (state >> 40)));
+        }
+
+        Bench::consume(key(heap.top()));
+    });
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 20);
+    std::size_t operations = Bench::argument(argc, argv, 2, std::size_t(1) << 22);
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    using SmallHeap = PriorityQueue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>>;
+    using SmallStd = std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>>;
+    using LargeHeap = PriorityQueue<Timer, std::vector<Timer>, std::greater<Timer>>;
+    using LargeStd = std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>>;
+
+    double items = static_cast<double>(n);
+    double ops = static_cast<double>(operations);
+
+    Bench::report("PriorityQueue<u64> fill/drain", fillDrain<SmallHeap, std::uint64_t>(n, runs), items, "elems");
+    Bench::report("std::priority_queue<u64> fill/drain", fillDrain<SmallStd, std::uint64_t>(n, runs), items, "elems");
+    Bench::report("PriorityQueue<128B> fill/drain", fillDrain<LargeHeap, Timer>(n, runs), items, "elems");
+    Bench::report("std::priority_queue<128B> fill/drain", fillDrain<LargeStd, Timer>(n, runs), items, "elems");
+
+    Bench::report("PriorityQueue<u64> hold pop+push", hold<SmallHeap, std::uint64_t>(n, operations, runs), ops, "ops");
+    Bench::report("std::priority_queue<u64> hold pop+push", hold<SmallStd, std::uint64_t>(n, operations, runs), ops, "ops");
+    Bench::report("PriorityQueue<128B> hold pop+push", hold<LargeHeap, Timer>(n, operations, runs), ops, "ops");
+    Bench::report("std::priority_queue<128B> hold pop+push", hold<LargeStd, Timer>(n, operations, runs), ops, "ops");
+
+    return 0;
+}
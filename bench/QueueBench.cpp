@@ -0,0 +1,94 @@
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+
+#include "../Queue/Queue.hpp"
+
+#include "Bench.hpp"
+
+struct Frame
+{
+    std::uint64_t id;
+    std::uint32_t length;
+    std::uint32_t flags;
+    unsigned char payload[48];
+};
+
+struct OpaqueFrame : Frame
+{
+    OpaqueFrame(const Frame& frame) : Frame(frame) { }
+    OpaqueFrame(const OpaqueFrame& other) : Frame(other) { }
+    OpaqueFrame& operator=(const OpaqueFrame& other) { Frame::operator=(other); return *this; }
+};
+
+template <typename Q, typename F>
+static double sawtooth(std::size_t peak, std::size_t rounds, std::size_t runs)
+{
+    return Bench::measure(runs, [&]()
+    {
+        std::uint64_t sum = 0;
+
+        for (std::size_t round = 0; round < rounds; round++)
+        {
+            Q queue;
+            Frame frame{};
+
+            for (std::size_t tooth = 0; tooth < 4; tooth++)
+            {
+                for (std::size_t i = 0; i < peak; i++)
+                {
+                    frame.id = i;
+                    queue.push(F(frame));
+                }
+
+                for (std::size_t i = 0; i < peak / 2 + peak / 4 * tooth; i++)
+                {
+                    sum += queue.front().id;
+                    queue.pop();
+                }
+            }
+        }
+
+        Bench::consume(sum);
+    });
+}
+
+template <typename F>
+static double copy(std::size_t peak, std::size_t rounds, std::size_t runs)
+{
+    Queue<F> source;
+    Frame frame{};
+
+    for (std::size_t i = 0; i < peak; i++) source.push(F(frame));
+    for (std::size_t i = 0; i < peak / 3; i++) source.pop();
+    for (std::size_t i = 0; i < peak / 3; i++) source.push(F(frame));
+
+    return Bench::measure(runs, [&]()
+    {
+        for (std::size_t round = 0; round < rounds; round++)
+        {
+            Queue<F> target(source);
+            Bench::consume(target.front().id);
+        }
+    });
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t peak = Bench::argument(argc, argv, 1, std::size_t(1) << 16);
+    std::size_t rounds = Bench::argument(argc, argv, 2, std::size_t(64));
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    double frames = static_cast<double>(peak * 4 * rounds);
+
+    Bench::report("Queue<Frame> sawtooth", sawtooth<Queue<Frame>, Frame>(peak, rounds, runs), frames, "frames");
+    Bench::report("Queue<OpaqueFrame> sawtooth", sawtooth<Queue<OpaqueFrame>, OpaqueFrame>(peak, rounds, runs), frames, "frames");
+    Bench::report("std::queue<Frame> sawtooth", sawtooth<std::queue<Frame>, Frame>(peak, rounds, runs), frames, "frames");
+
+    double copied = static_cast<double>(peak * rounds);
+
+    Bench::report("Queue<Frame> copy (wrapped)", copy<Frame>(peak, rounds, runs), copied, "frames");
+    Bench::report("Queue<OpaqueFrame> copy (wrapped)", copy<OpaqueFrame>(peak, rounds, runs), copied, "frames");
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "../PriorityQueue/PriorityQueue.hpp"
+#include "../PriorityQueue/RadixHeap.hpp"
+
+#include "Bench.hpp"
+
+using Entry = std::pair<std::uint64_t, std::uint32_t>;
+
+struct Graph
+{
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> targets;
+    std::vector<std::uint32_t> weights;
+};
+
+static std::uint64_t next(std::uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state;
+}
+
+static Graph randomGraph(std::size_t vertices, std::size_t degree)
+{
+    Graph graph;
+    graph.offsets.resize(vertices + 1);
+    graph.targets.reserve(vertices * degree);
+    graph.weights.reserve(vertices * degree);
+
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t v = 0; v < vertices; v++)
+    {
+        graph.offsets[v] = static_cast<std::uint32_t>(graph.targets.size());
+
+        for (std::size_t e = 0; e < degree; e++)
+        {
+            std::uint64_t bits = next(state);
+
+            graph.targets.push_back(static_cast<std::uint32_t>(bits % vertices));
+            graph.weights.push_back(static_cast<std::uint32_t>((bits >> 32) % 1000 + 1));
+        }
+    }
+
+    graph.offsets[vertices] = static_cast<std::uint32_t>(graph.targets.size());
+    return graph;
+}
+
+template <typename Heap>
+static double timers(std::size_t live, std::size_t expiries, std::size_t runs)
+{
+    return Bench::measure(runs, [&]()
+    {
+        Heap heap;
+        std::uint64_t state = 2463534242ull;
+
+        for (std::size_t i = 0; i < live; i++) heap.push(next(state) >> 44);
+
+        std::uint64_t now = 0;
+
+        for (std::size_t i = 0; i < expiries; i++)
+        {
+            heap.pop(now);
+            heap.push(now + (next(state) >> 44));
+        }
+
+        Bench::consume(now);
+    });
+}
+
+template <typename Heap>
+static std::uint64_t dijkstra(const Graph& graph)
+{
+    std::size_t vertices = graph.offsets.size() - 1;
+    if (vertices == 0) return 0;
+
+    std::vector<std::uint64_t> dist(vertices, std::numeric_limits<std::uint64_t>::max());
+
+    Heap heap;
+
+    dist[0] = 0;
+    heap.push(Entry(0, 0));
+
+    std::uint64_t total = 0;
+
+    while (!heap.empty())
+    {
+        Entry entry;
+        heap.pop(entry);
+
+        if (entry.first != dist[entry.second]) continue;
+
+        total += entry.first;
+
+        for (std::uint32_t e = graph.offsets[entry.second]; e < graph.offsets[entry.second + 1]; e++)
+        {
+            std::uint32_t target = graph.targets[e];
+            std::uint64_t candidate = entry.first + graph.weights[e];
+
+            if (candidate >= dist[target]) continue;
+
+            heap.push(Entry(candidate, target));
+            dist[target] = candidate;
+        }
+    }
+
+    return total;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t live = Bench::argument(argc, argv, 1, std::size_t(1) << 16);
+    std::size_t expiries = Bench::argument(argc, argv, 2, std::size_t(1) << 23);
+    std::size_t vertices = Bench::argument(argc, argv, 3, std::size_t(1) << 20);
+    std::size_t runs = Bench::argument(argc, argv, 4, 3);
+
+    using BinaryTimers = PriorityQueue<std::uint64_t, std::vector<std::uint64_t>, std::greater<std::uint64_t>>;
+    using BinaryEntries = PriorityQueue<Entry, std::vector<Entry>, std::greater<Entry>>;
+
+    double expired = static_cast<double>(expiries);
+
+    Bench::report("RadixHeap timer expiry", timers<RadixHeap<std::uint64_t>>(live, expiries, runs), expired, "timers");
+    Bench::report("PriorityQueue timer expiry", timers<BinaryTimers>(live, expiries, runs), expired, "timers");
+
+    Graph graph = randomGraph(vertices, 8);
+    double edges = static_cast<double>(graph.targets.size());
+
+    std::uint64_t radixTotal = 0;
+    std::uint64_t binaryTotal = 0;
+
+    double radixTime = Bench::measure(runs, [&]() { radixTotal = dijkstra<RadixHeap<Entry>>(graph); });
+    double binaryTime = Bench::measure(runs, [&]() { binaryTotal = dijkstra<BinaryEntries>(graph); });
+
+    if (radixTotal != binaryTotal)
+    {
+        std::fprintf(stderr, "distance mismatch: %llu != %llu\n", static_cast<unsigned long long>(radixTotal), static_cast<unsigned long long>(binaryTotal));
+        return 1;
+    }
+
+    Bench::report("RadixHeap Dijkstra", radixTime, edges, "edges");
+    Bench::report("PriorityQueue Dijkstra", binaryTime, edges, "edges");
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../Queue/Queue.hpp"
+
+#include "Bench.hpp"
+
+static double spscSingle(std::size_t messages)
+{
+    SPSCQueue<std::uint64_t> queue(1024);
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    std::thread consumer([&queue, messages]()
+    {
+        Bench::pin(1);
+
+        std::uint64_t sum = 0;
+        std::uint64_t val = 0;
+        std::size_t spins = 0;
+
+        for (std::size_t received = 0; received < messages;)
+        {
+            if (queue.try_pop(val))
+            {
+                sum += val;
+                received++;
+            }
+            else
+            {
+                Bench::backoff(spins);
+            }
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::pin(0);
+    std::size_t spins = 0;
+
+    for (std::size_t i = 0; i < messages; i++)
+    {
+        while (!queue.try_push(static_cast<std::uint64_t>(i))) Bench::backoff(spins);
+    }
+
+    consumer.join();
+    return Bench::since(start);
+}
+
+static double spscBatched(std::size_t messages, std::size_t batch)
+{
+    SPSCQueue<std::uint64_t> queue(1024);
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    std::thread consumer([&queue, messages, batch]()
+    {
+        Bench::pin(1);
+
+        std::vector<std::uint64_t> buffer(batch);
+        std::uint64_t sum = 0;
+        std::size_t spins = 0;
+
+        for (std::size_t received = 0; received < messages;)
+        {
+            std::size_t taken = queue.pop_n(buffer.data(), batch);
+            if (taken == 0) Bench::backoff(spins);
+
+            for (std::size_t i = 0; i < taken; i++) sum += buffer[i];
+            received += taken;
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::pin(0);
+
+    std::vector<std::uint64_t> buffer(batch);
+    std::size_t spins = 0;
+
+    for (std::size_t sent = 0; sent < messages;)
+    {
+        std::size_t count = std::min(batch, messages - sent);
+        for (std::size_t i = 0; i < count; i++) buffer[i] = sent + i;
+
+        std::size_t offset = 0;
+        while (offset < count)
+        {
+            std::size_t pushed = queue.push_n(buffer.data() + offset, count - offset);
+            if (pushed == 0) Bench::backoff(spins);
+
+            offset += pushed;
+        }
+
+        sent += count;
+    }
+
+    consumer.join();
+    return Bench::since(start);
+}
+
+static double mutexQueue(std::size_t messages)
+{
+    Queue<std::uint64_t> queue;
+    std::mutex mutex;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    std::thread consumer([&queue, &mutex, messages]()
+    {
+        Bench::pin(1);
+
+        std::uint64_t sum = 0;
+        std::size_t spins = 0;
+
+        for (std::size_t received = 0; received < messages;)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            if (queue.isEmpty())
+            {
+                lock.unlock();
+                Bench::backoff(spins);
+                continue;
+            }
+
+            sum += queue.front();
+            queue.pop();
+            received++;
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::pin(0);
+
+    for (std::size_t i = 0; i < messages; i++)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push(static_cast<std::uint64_t>(i));
+    }
+
+    consumer.join();
+    return Bench::since(start);
+}
+
+static double pingPong(std::size_t roundTrips)
+{
+    SPSCQueue<std::uint64_t> ping(64);
+    SPSCQueue<std::uint64_t> pong(64);
+
+    std::thread echo([&ping, &pong, roundTrips]()
+    {
+        Bench::pin(1);
+
+        std::uint64_t val = 0;
+        std::size_t spins = 0;
+
+        for (std::size_t i = 0; i < roundTrips; i++)
+        {
+            while (!ping.try_pop(val)) Bench::backoff(spins);
+            while (!pong.try_push(val)) Bench::backoff(spins);
+        }
+    });
+
+    Bench::pin(0);
+
+    std::uint64_t val = 0;
+    std::size_t spins = 0;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+
+    for (std::size_t i = 0; i < roundTrips; i++)
+    {
+        while (!ping.try_push(static_cast<std::uint64_t>(i))) Bench::backoff(spins);
+        while (!pong.try_pop(val)) Bench::backoff(spins);
+    }
+
+    double seconds = Bench::since(start);
+    echo.join();
+
+    return seconds;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t messages = Bench::argument(argc, argv, 1, std::size_t(1) << 24);
+    std::size_t roundTrips = Bench::argument(argc, argv, 2, std::size_t(1) << 18);
+
+    Bench::report("SPSCQueue try_push/try_pop", spscSingle(messages), static_cast<double>(messages), "msgs");
+    Bench::report("SPSCQueue push_n/pop_n (batch 64)", spscBatched(messages, 64), static_cast<double>(messages), "msgs");
+    Bench::report("mutex + Queue", mutexQueue(messages), static_cast<double>(messages), "msgs");
+
+    double latency = pingPong(roundTrips);
+    std::printf("%-48s %10.1f ns per round trip\n", "SPSCQueue ping-pong", latency * 1e9 / static_cast<double>(roundTrips));
+
+    return 0;
+}
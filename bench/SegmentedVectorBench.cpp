@@ -0,0 +1,57 @@
+#include <cstddef>
+#include <cstdint>
+
+#include "../Vector/Vector.hpp"
+#include "../Vector/SegmentedVector.hpp"
+#include "../LinkedList/LinkedList.hpp"
+
+#include "Bench.hpp"
+
+template <typename Container>
+static void appendAndIterate(const char* appendName, const char* iterateName, std::size_t n, std::size_t runs)
+{
+    double append = Bench::measure(runs, [&]()
+    {
+        Container container;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            container.push_back(static_cast<std::uint64_t>(i));
+        }
+
+        Bench::consume(static_cast<std::uint64_t>(container.getSize()));
+    });
+
+    Container container;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        container.push_back(static_cast<std::uint64_t>(i));
+    }
+
+    double iterate = Bench::measure(runs, [&]()
+    {
+        std::uint64_t sum = 0;
+
+        for (auto it = container.begin(); it != container.end(); ++it)
+        {
+            sum += *it;
+        }
+
+        Bench::consume(sum);
+    });
+
+    Bench::report(appendName, append, static_cast<double>(n), "elems");
+    Bench::report(iterateName, iterate, static_cast<double>(n), "elems");
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 23);
+    std::size_t runs = Bench::argument(argc, argv, 2, 3);
+
+    appendAndIterate<Vector<std::uint64_t>>("Vector append", "Vector iterate", n, runs);
+    appendAndIterate<SegmentedVector<std::uint64_t>>("SegmentedVector append", "SegmentedVector iterate", n, runs);
+    appendAndIterate<LinkedList<std::uint64_t>>("LinkedList append", "LinkedList iterate", n, runs);
+
+    return 0;
+}
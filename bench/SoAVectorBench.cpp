@@ -0,0 +1,71 @@
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#include "../Vector/Vector.hpp"
+#include "../Vector/SoAVector.hpp"
+
+#include "Bench.hpp"
+
+struct Particle
+{
+    float x, y, z;
+    float vx, vy, vz;
+    float mass;
+    std::uint32_t id;
+};
+
+using ParticleFields = std::tuple<float, float, float, float, float, float, float, std::uint32_t>;
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, 1 << 24);
+    std::size_t runs = Bench::argument(argc, argv, 2, 5);
+
+    Vector<Particle> rows;
+    SoAVector<ParticleFields> columns;
+
+    rows.reserve(n);
+    columns.reserve(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        float f = static_cast<float>(i % 1024);
+        std::uint32_t id = static_cast<std::uint32_t>(i);
+
+        rows.push_back(Particle{ f, f, f, 1.0f, 2.0f, 3.0f, f, id });
+        columns.push_back(f, f, f, 1.0f, 2.0f, 3.0f, f, id);
+    }
+
+    double aos = Bench::measure(runs, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            sum += static_cast<double>(rows[i].x * rows[i].mass);
+        }
+
+        Bench::consume(static_cast<std::uint64_t>(sum));
+    });
+
+    double soa = Bench::measure(runs, [&]()
+    {
+        Span<float> x = columns.getField<0>();
+        Span<float> mass = columns.getField<6>();
+
+        double sum = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            sum += static_cast<double>(x.getData()[i] * mass.getData()[i]);
+        }
+
+        Bench::consume(static_cast<std::uint64_t>(sum));
+    });
+
+    double bytes = static_cast<double>(n * 2 * sizeof(float));
+
+    Bench::report("Vector<Particle> scan x*mass", aos, bytes, "B");
+    Bench::report("SoAVector scan x*mass", soa, bytes, "B");
+
+    return 0;
+}
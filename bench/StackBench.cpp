@@ -0,0 +1,161 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stack>
+#include <vector>
+
+#include "../Stack/Stack.hpp"
+
+#include "Bench.hpp"
+
+struct Frame
+{
+    std::uint64_t node;
+    std::uint64_t parent;
+    std::uint32_t depth;
+    std::uint32_t child;
+};
+
+struct Tree
+{
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> children;
+};
+
+static Tree randomTree(std::size_t nodes)
+{
+    Tree tree;
+    tree.offsets.assign(nodes + 1, 0);
+    tree.children.reserve(nodes);
+
+    std::vector<std::uint32_t> parents(nodes, 0);
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t i = 1; i < nodes; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        std::size_t window = i < 64 ? i : 64;
+        parents[i] = static_cast<std::uint32_t>(i - 1 - state % window);
+        tree.offsets[parents[i] + 1]++;
+    }
+
+    for (std::size_t i = 0; i < nodes; i++) tree.offsets[i + 1] += tree.offsets[i];
+
+    std::vector<std::uint32_t> cursor(tree.offsets.begin(), tree.offsets.end() - 1);
+    tree.children.resize(nodes > 0 ? nodes - 1 : 0);
+
+    for (std::size_t i = 1; i < nodes; i++) tree.children[cursor[parents[i]]++] = static_cast<std::uint32_t>(i);
+
+    return tree;
+}
+
+static void prepare(Stack<Frame>& stack, std::size_t n)
+{
+    stack.reserve(n);
+}
+
+static void prepare(std::stack<Frame, std::vector<Frame>>&, std::size_t)
+{
+}
+
+template <typename S>
+static double sawtooth(std::size_t depth, std::size_t rounds, std::size_t runs, bool reserve)
+{
+    return Bench::measure(runs, [&]()
+    {
+        std::uint64_t sum = 0;
+
+        for (std::size_t round = 0; round < rounds; round++)
+        {
+            S stack;
+            if (reserve) prepare(stack, depth);
+
+            for (std::size_t i = 0; i < depth; i++)
+            {
+                stack.push(Frame{ i, i / 2, static_cast<std::uint32_t>(round), 0 });
+            }
+
+            for (std::size_t i = 0; i < depth; i++)
+            {
+                sum += stack.top().node;
+                stack.pop();
+            }
+        }
+
+        Bench::consume(sum);
+    });
+}
+
+static std::uint64_t dfsStack(const Tree& tree)
+{
+    Stack<std::uint32_t> stack;
+    stack.push(0);
+
+    std::uint64_t sum = 0;
+
+    while (!stack.isEmpty())
+    {
+        std::uint32_t node = stack.top();
+        stack.pop();
+
+        sum += node;
+        stack.push_range(tree.children.data() + tree.offsets[node], tree.children.data() + tree.offsets[node + 1]);
+    }
+
+    return sum;
+}
+
+static std::uint64_t dfsStd(const Tree& tree)
+{
+    std::stack<std::uint32_t, std::vector<std::uint32_t>> stack;
+    stack.push(0);
+
+    std::uint64_t sum = 0;
+
+    while (!stack.empty())
+    {
+        std::uint32_t node = stack.top();
+        stack.pop();
+
+        sum += node;
+        for (std::uint32_t i = tree.offsets[node]; i < tree.offsets[node + 1]; i++) stack.push(tree.children[i]);
+    }
+
+    return sum;
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t depth = Bench::argument(argc, argv, 1, std::size_t(1) << 20);
+    std::size_t rounds = Bench::argument(argc, argv, 2, std::size_t(32));
+    std::size_t nodes = Bench::argument(argc, argv, 3, std::size_t(1) << 22);
+    std::size_t runs = Bench::argument(argc, argv, 4, 3);
+
+    double frames = static_cast<double>(depth * rounds);
+
+    Bench::report("Stack<Frame> deep push/pop", sawtooth<Stack<Frame>>(depth, rounds, runs, false), frames, "frames");
+    Bench::report("Stack<Frame> deep push/pop (reserved)", sawtooth<Stack<Frame>>(depth, rounds, runs, true), frames, "frames");
+    Bench::report("std::stack<Frame> deep push/pop", sawtooth<std::stack<Frame, std::vector<Frame>>>(depth, rounds, runs, false), frames, "frames");
+
+    Tree tree = randomTree(nodes);
+
+    std::uint64_t stackSum = 0;
+    std::uint64_t stdSum = 0;
+
+    double stackTime = Bench::measure(runs, [&]() { stackSum = dfsStack(tree); });
+    double stdTime = Bench::measure(runs, [&]() { stdSum = dfsStd(tree); });
+
+    if (stackSum != stdSum)
+    {
+        std::fprintf(stderr, "traversal mismatch\n");
+        return 1;
+    }
+
+    Bench::report("Stack<u32> DFS (push_range)", stackTime, static_cast<double>(nodes), "nodes");
+    Bench::report("std::stack<u32> DFS", stdTime, static_cast<double>(nodes), "nodes");
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "../PriorityQueue/PriorityQueue.hpp"
+#include "../PriorityQueue/TimerWheel.hpp"
+
+#include "Bench.hpp"
+
+struct Connection : TimerNode
+{
+    std::uint32_t id;
+};
+
+struct Workload
+{
+    std::size_t connections;
+    std::size_t ticks;
+    std::size_t activity;
+};
+
+static std::uint64_t next(std::uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state;
+}
+
+static std::uint64_t timeout(std::uint64_t id, std::uint64_t now)
+{
+    std::uint64_t hash = (id * 0x9E3779B97F4A7C15ull) ^ (now * 0xC2B2AE3D27D4EB4Full);
+    hash ^= hash >> 29;
+
+    return now + 1000 + hash % 4000;
+}
+
+static std::size_t wheel(const Workload& load)
+{
+    std::vector<Connection> connections(load.connections);
+    std::vector<Connection*> expired;
+
+    TimerWheel wheel;
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t i = 0; i < load.connections; i++)
+    {
+        connections[i].id = static_cast<std::uint32_t>(i);
+        wheel.schedule(connections[i], timeout(i, 0));
+    }
+
+    std::size_t closed = 0;
+
+    for (std::uint64_t now = 1; now <= load.ticks; now++)
+    {
+        for (std::size_t i = 0; i < load.activity; i++)
+        {
+            Connection& conn = connections[next(state) % load.connections];
+            wheel.schedule(conn, timeout(conn.id, now));
+        }
+
+        expired.clear();
+        wheel.advance(now, [&expired](TimerNode& node) { expired.push_back(static_cast<Connection*>(&node)); });
+
+        for (Connection* conn : expired)
+        {
+            wheel.schedule(*conn, timeout(conn->id, now));
+            closed++;
+        }
+    }
+
+    return closed;
+}
+
+static std::size_t heap(const Workload& load, std::size_t& peak)
+{
+    using Entry = std::pair<std::uint64_t, std::uint32_t>;
+
+    std::vector<std::uint64_t> deadlines(load.connections);
+
+    PriorityQueue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    heap.reserve(load.connections);
+
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t i = 0; i < load.connections; i++)
+    {
+        deadlines[i] = timeout(i, 0);
+        heap.push(Entry(deadlines[i], static_cast<std::uint32_t>(i)));
+    }
+
+    std::size_t closed = 0;
+    peak = heap.size();
+
+    for (std::uint64_t now = 1; now <= load.ticks; now++)
+    {
+        for (std::size_t i = 0; i < load.activity; i++)
+        {
+            std::uint32_t id = static_cast<std::uint32_t>(next(state) % load.connections);
+
+            deadlines[id] = timeout(id, now);
+            heap.push(Entry(deadlines[id], id));
+        }
+
+        while (!heap.empty() && heap.top().first <= now)
+        {
+            Entry entry;
+            heap.pop(entry);
+
+            if (entry.first != deadlines[entry.second]) continue;
+
+            deadlines[entry.second] = timeout(entry.second, now);
+            heap.push(Entry(deadlines[entry.second], entry.second));
+            closed++;
+        }
+
+        if (heap.size() > peak) peak = heap.size();
+    }
+
+    return closed;
+}
+
+int main(int argc, char** argv)
+{
+    Workload load;
+    load.connections = Bench::argument(argc, argv, 1, std::size_t(1) << 20);
+    load.ticks = Bench::argument(argc, argv, 2, std::size_t(10000));
+    load.activity = Bench::argument(argc, argv, 3, load.connections / 4000);
+
+    std::size_t runs = Bench::argument(argc, argv, 4, 3);
+
+    std::size_t wheelClosed = 0;
+    std::size_t heapClosed = 0;
+    std::size_t peak = 0;
+
+    double wheelTime = Bench::measure(runs, [&]() { wheelClosed = wheel(load); });
+    double heapTime = Bench::measure(runs, [&]() { heapClosed = heap(load, peak); });
+
+    if (wheelClosed != heapClosed)
+    {
+        std::fprintf(stderr, "expiry mismatch: %zu != %zu\n", wheelClosed, heapClosed);
+        return 1;
+    }
+
+    double events = static_cast<double>(load.ticks * load.activity + wheelClosed);
+
+    Bench::report("TimerWheel connection timeouts", wheelTime, events, "events");
+    Bench::report("PriorityQueue connection timeouts", heapTime, events, "events");
+
+    std::printf("%-48s %10zu expired %10zu peak heap entries\n", "connections", wheelClosed, peak);
+
+    return 0;
+}
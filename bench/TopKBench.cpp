@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../PriorityQueue/PriorityQueue.hpp"
+#include "../PriorityQueue/TopK.hpp"
+
+#include "Bench.hpp"
+
+int main(int argc, char** argv)
+{
+    std::size_t n = Bench::argument(argc, argv, 1, std::size_t(1) << 24);
+    std::size_t batch = Bench::argument(argc, argv, 2, std::size_t(4096));
+    std::size_t runs = Bench::argument(argc, argv, 3, 3);
+
+    std::vector<std::uint64_t> stream(n);
+    std::uint64_t state = 2463534242ull;
+
+    for (std::uint64_t& val : stream)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        val = state;
+    }
+
+    std::size_t ks[] = { 10, 100, 1000, 10000, 100000 };
+    double items = static_cast<double>(n);
+
+    for (std::size_t k : ks)
+    {
+        std::string suffix = " (K = " + std::to_string(k) + ")";
+
+        std::vector<std::uint64_t> single;
+        std::vector<std::uint64_t> batched;
+        std::vector<std::uint64_t> full;
+
+        double offerTime = Bench::measure(runs, [&]()
+        {
+            TopK<std::uint64_t> top(k);
+            for (std::uint64_t val : stream) top.offer(val);
+
+            single = top.drain();
+        });
+
+        double batchTime = Bench::measure(runs, [&]()
+        {
+            TopK<std::uint64_t> top(k);
+
+            for (std::size_t offset = 0; offset < n; offset += batch)
+            {
+                std::size_t count = std::min(batch, n - offset);
+                top.offer(stream.begin() + static_cast<std::ptrdiff_t>(offset), stream.begin() + static_cast<std::ptrdiff_t>(offset + count));
+            }
+
+            batched = top.drain();
+        });
+
+        double fullTime = Bench::measure(runs, [&]()
+        {
+            PriorityQueue<std::uint64_t> heap(stream.begin(), stream.end());
+
+            full.clear();
+            for (std::size_t i = 0; i < k && !heap.empty(); i++)
+            {
+                full.push_back(heap.top());
+                heap.pop();
+            }
+        });
+
+        if (single != batched || single != full)
+        {
+            std::fprintf(stderr, "top-%zu mismatch\n", k);
+            return 1;
+        }
+
+        Bench::report(("TopK offer" + suffix).c_str(), offerTime, items, "elems");
+        Bench::report(("TopK offer(range)" + suffix).c_str(), batchTime, items, "elems");
+        Bench::report(("PriorityQueue of whole stream" + suffix).c_str(), fullTime, items, "elems");
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../Stack/FixedStack.hpp"
+#include "../Stack/SmallStack.hpp"
+#include "../Stack/Stack.hpp"
+
+#include "Bench.hpp"
+
+struct Node
+{
+    Node* children[4];
+    std::uint32_t count;
+    std::uint32_t value;
+};
+
+static std::vector<Node> randomTree(std::size_t nodes, std::uint64_t& state)
+{
+    std::vector<Node> tree(nodes);
+
+    for (std::size_t i = 0; i < nodes; i++)
+    {
+        tree[i].count = 0;
+        tree[i].value = static_cast<std::uint32_t>(i);
+    }
+
+    for (std::size_t i = 1; i < nodes; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        std::size_t window = i < 8 ? i : 8;
+        Node* parent = &tree[i - 1 - state % window];
+        if (parent->count == 4) parent = &tree[i - 1];
+
+        parent->children[parent->count++] = &tree[i];
+    }
+
+    return tree;
+}
+
+template <typename S>
+static std::uint64_t traverse(const Node* root)
+{
+    S stack;
+    stack.push(const_cast<Node*>(root));
+
+    std::uint64_t sum = 0;
+
+    while (!stack.isEmpty())
+    {
+        Node* node = stack.top();
+        stack.pop();
+
+        sum += node->value;
+        for (std::uint32_t i = 0; i < node->count; i++) stack.push(node->children[i]);
+    }
+
+    return sum;
+}
+
+template <typename S>
+static double forest(const std::vector<std::vector<Node>>& trees, std::size_t passes, std::size_t runs, std::uint64_t& checksum)
+{
+    return Bench::measure(runs, [&]()
+    {
+        std::uint64_t sum = 0;
+
+        for (std::size_t pass = 0; pass < passes; pass++)
+        {
+            for (const std::vector<Node>& tree : trees) sum += traverse<S>(tree.data());
+        }
+
+        checksum = sum;
+    });
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = Bench::argument(argc, argv, 1, std::size_t(256));
+    std::size_t small = Bench::argument(argc, argv, 2, std::size_t(64));
+    std::size_t large = Bench::argument(argc, argv, 3, std::size_t(1) << 16);
+    std::size_t passes = Bench::argument(argc, argv, 4, std::size_t(512));
+    std::size_t runs = Bench::argument(argc, argv, 5, 3);
+
+    std::uint64_t state = 2463534242ull;
+
+    std::vector<std::vector<Node>> smallTrees;
+    std::vector<std::vector<Node>> largeTrees;
+
+    for (std::size_t i = 0; i < count; i++) smallTrees.push_back(randomTree(small, state));
+    for (std::size_t i = 0; i < std::max<std::size_t>(1, count * small / large); i++) largeTrees.push_back(randomTree(large, state));
+
+    std::uint64_t expected = 0;
+    std::uint64_t checksum = 0;
+    bool matched = true;
+
+    double smallNodes = static_cast<double>(count * small * passes);
+    std::string suffix = " (" + std::to_string(small) + "-node trees)";
+
+    Bench::report(("Stack<Node*>" + suffix).c_str(), forest<Stack<Node*>>(smallTrees, passes, runs, expected), smallNodes, "nodes");
+    Bench::report(("SmallStack<Node*, 64>" + suffix).c_str(), forest<SmallStack<Node*, 64>>(smallTrees, passes, runs, checksum), smallNodes, "nodes");
+    matched = matched && checksum == expected;
+
+    Bench::report(("FixedStack<Node*, 1024>" + suffix).c_str(), forest<FixedStack<Node*, 1024>>(smallTrees, passes, runs, checksum), smallNodes, "nodes");
+    matched = matched && checksum == expected;
+
+    double largeNodes = static_cast<double>(largeTrees.size() * large * passes);
+    suffix = " (" + std::to_string(large) + "-node trees)";
+
+    Bench::report(("Stack<Node*>" + suffix).c_str(), forest<Stack<Node*>>(largeTrees, passes, runs, expected), largeNodes, "nodes");
+    Bench::report(("SmallStack<Node*, 64>" + suffix).c_str(), forest<SmallStack<Node*, 64>>(largeTrees, passes, runs, checksum), largeNodes, "nodes");
+    matched = matched && checksum == expected;
+
+    if (!matched)
+    {
+        std::fprintf(stderr, "traversal mismatch\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "../Vector/Vector.hpp"
+#include "../Parallel/WorkStealingPool.hpp"
+
+#include "Bench.hpp"
+
+static const std::uint64_t FIB_CUTOFF = 20;
+static const std::size_t SORT_CUTOFF = 1 << 12;
+
+static std::uint64_t fib(std::uint64_t n)
+{
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+static std::uint64_t fib(WorkStealingPool& pool, std::uint64_t n)
+{
+    if (n < FIB_CUTOFF) return fib(n);
+
+    std::uint64_t left = 0;
+    std::uint64_t right = 0;
+
+    pool.invoke([&]() { left = fib(pool, n - 1); }, [&]() { right = fib(pool, n - 2); });
+
+    return left + right;
+}
+
+static void quicksort(WorkStealingPool& pool, std::uint64_t* first, std::uint64_t* last)
+{
+    if (static_cast<std::size_t>(last - first) < SORT_CUTOFF)
+    {
+        std::sort(first, last);
+        return;
+    }
+
+    std::uint64_t pivot = first[(last - first) / 2];
+
+    std::uint64_t* middle = std::partition(first, last, [pivot](std::uint64_t val) { return val < pivot; });
+    std::uint64_t* upper = std::partition(middle, last, [pivot](std::uint64_t val) { return !(pivot < val); });
+
+    pool.invoke([&]() { quicksort(pool, first, middle); }, [&]() { quicksort(pool, upper, last); });
+}
+
+static double calls(std::uint64_t n)
+{
+    double prev = 1;
+    double curr = 1;
+
+    for (std::uint64_t i = 0; i < n; i++)
+    {
+        double next = prev + curr + 1;
+        prev = curr;
+        curr = next;
+    }
+
+    return prev;
+}
+
+static void fill(Vector<std::uint64_t>& values)
+{
+    std::uint64_t state = 2463534242ull;
+
+    for (std::size_t i = 0; i < values.getSize(); i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        values[i] = state;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::uint64_t depth = Bench::argument(argc, argv, 1, std::size_t(32));
+    std::size_t n = Bench::argument(argc, argv, 2, std::size_t(1) << 23);
+    std::size_t maxThreads = Bench::argument(argc, argv, 3, std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+    std::size_t runs = Bench::argument(argc, argv, 4, 3);
+
+    Vector<std::uint64_t> values(n);
+
+    double serialFib = Bench::measure(runs, [&]() { Bench::consume(fib(depth)); });
+
+    double serialSort = 0;
+    for (std::size_t run = 0; run < runs; run++)
+    {
+        fill(values);
+
+        double elapsed = Bench::measure(1, [&]() { std::sort(values.begin(), values.end()); });
+        if (run == 0 || elapsed < serialSort) serialSort = elapsed;
+    }
+
+    Bench::report("fib (serial)", serialFib, calls(depth), "calls");
+    Bench::report("quicksort (serial std::sort)", serialSort, static_cast<double>(n), "elems");
+
+    for (std::size_t threads = 1; threads <= maxThreads; threads++)
+    {
+        WorkStealingPool pool(threads);
+
+        double parallelFib = Bench::measure(runs, [&]() { Bench::consume(fib(pool, depth)); });
+
+        double parallelSort = 0;
+        for (std::size_t run = 0; run < runs; run++)
+        {
+            fill(values);
+
+            double elapsed = Bench::measure(1, [&]() { quicksort(pool, &values[0], &values[0] + n); });
+            if (run == 0 || elapsed < parallelSort) parallelSort = elapsed;
+        }
+
+        std::string suffix = " (" + std::to_string(threads) + (threads == 1 ? " worker)" : " workers)");
+
+        Bench::report(("fib" + suffix).c_str(), parallelFib, calls(depth), "calls");
+        Bench::report(("quicksort" + suffix).c_str(), parallelSort, static_cast<double>(n), "elems");
+    }
+
+    return 0;
+}
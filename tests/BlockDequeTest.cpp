@@ -0,0 +1,59 @@
+#include <cstddef>
+
+#include "../Deque/BlockDeque.hpp"
+
+#include "Check.hpp"
+
+static void fullMapWalk()
+{
+    for (std::size_t n = 1; n <= 256; n++)
+    {
+        BlockDeque<int, 4> deque;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            deque.push_back(static_cast<int>(i));
+        }
+
+        int expected = 0;
+        for (BlockDeque<int, 4>::Iterator it = deque.begin(); it != deque.end(); ++it)
+        {
+            CHECK(*it == expected++);
+        }
+
+        CHECK(static_cast<std::size_t>(expected) == n);
+        CHECK(static_cast<std::size_t>(deque.end() - deque.begin()) == n);
+
+        BlockDeque<int, 4>::Iterator last = deque.end();
+        --last;
+
+        const int* back = last.operator->();
+        CHECK(back != nullptr && *back == static_cast<int>(n) - 1);
+    }
+}
+
+static void pushFrontWalk()
+{
+    BlockDeque<int, 4> deque;
+
+    for (int i = 0; i < 256; i++)
+    {
+        deque.push_front(i);
+    }
+
+    int expected = 255;
+    for (BlockDeque<int, 4>::ConstIterator it = deque.cbegin(); it != deque.cend(); ++it)
+    {
+        CHECK(*it == expected--);
+    }
+
+    CHECK(expected == -1);
+}
+
+int main()
+{
+    fullMapWalk();
+    pushFrontWalk();
+
+    return Check::result();
+}
@@ -0,0 +1,156 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include "../Queue/BlockingQueue.hpp"
+
+#include "Check.hpp"
+
+static void deliversEverything()
+{
+    const std::size_t producers = 4;
+    const std::size_t consumers = 3;
+    const std::size_t perProducer = 50000;
+
+    BlockingQueue<std::uint64_t> queue;
+
+    std::atomic<std::uint64_t> sum(0);
+    std::atomic<std::size_t> received(0);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t c = 0; c < consumers; c++)
+    {
+        threads.emplace_back([&queue, &sum, &received, c]()
+        {
+            std::vector<std::uint64_t> batch;
+            std::uint64_t val = 0;
+
+            while (true)
+            {
+                if (c == 0)
+                {
+                    if (!queue.pop(val)) break;
+
+                    sum += val;
+                    received++;
+                }
+                else if (c == 1)
+                {
+                    if (queue.pop_for(val, std::chrono::milliseconds(1)))
+                    {
+                        sum += val;
+                        received++;
+                    }
+                    else if (queue.isClosed() && queue.isEmpty())
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    batch.clear();
+                    std::size_t taken = queue.drain(std::back_inserter(batch), 64);
+                    if (taken == 0) break;
+
+                    for (std::uint64_t item : batch) sum += item;
+                    received += taken;
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> senders;
+
+    for (std::size_t p = 0; p < producers; p++)
+    {
+        senders.emplace_back([&queue, p]()
+        {
+            std::vector<std::uint64_t> burst;
+
+            for (std::size_t i = 0; i < perProducer; i++)
+            {
+                std::uint64_t val = p * perProducer + i + 1;
+
+                if (i % 8 == 0)
+                {
+                    queue.push(val);
+                    continue;
+                }
+
+                burst.push_back(val);
+                if (burst.size() == 7 || i + 1 == perProducer)
+                {
+                    queue.push_range(burst.begin(), burst.end());
+                    burst.clear();
+                }
+            }
+        });
+    }
+
+    for (std::thread& sender : senders) sender.join();
+
+    queue.close();
+
+    for (std::thread& thread : threads) thread.join();
+
+    std::uint64_t total = producers * perProducer;
+
+    CHECK(received == total);
+    CHECK(sum == total * (total + 1) / 2);
+}
+
+static void timesOut()
+{
+    BlockingQueue<int> queue;
+    int out = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    CHECK(!queue.pop_for(out, std::chrono::milliseconds(20)));
+    CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+    queue.push(5);
+    CHECK(queue.pop_for(out, std::chrono::milliseconds(20)) && out == 5);
+}
+
+static void closeWakesWaiters()
+{
+    BlockingQueue<int> queue;
+    std::atomic<std::size_t> woken(0);
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&queue, &woken]()
+        {
+            int out = 0;
+            if (!queue.pop(out)) woken++;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+
+    for (std::thread& thread : threads) thread.join();
+
+    CHECK(woken == 4);
+    CHECK(!queue.push(1));
+}
+
+int main()
+{
+    for (std::size_t round = 0; round < 5; round++)
+    {
+        deliversEverything();
+    }
+
+    timesOut();
+    closeWakesWaiters();
+
+    return Check::result();
+}
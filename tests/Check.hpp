@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdio>
+
+namespace Check
+{
+    inline int& failures()
+    {
+        static int count = 0;
+        return count;
+    }
+
+    inline void expect(bool condition, const char* what, const char* file, int line)
+    {
+        if (condition) return;
+
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+        failures()++;
+    }
+
+    inline int result()
+    {
+        return failures() == 0 ? 0 : 1;
+    }
+}
+
+#define CHECK(condition) Check::expect(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
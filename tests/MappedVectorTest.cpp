@@ -0,0 +1,122 @@
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../Vector/MappedVector.hpp"
+
+#include "Check.hpp"
+
+struct Record
+{
+    std::uint64_t id;
+    double value;
+};
+
+static std::string temporaryPath()
+{
+    char path[] = "/tmp/MappedVectorTest.XXXXXX";
+
+    int fd = ::mkstemp(path);
+    if (fd >= 0) ::close(fd);
+
+    return path;
+}
+
+static std::size_t fileSize(const std::string& path)
+{
+    struct stat info;
+    if (::stat(path.c_str(), &info) != 0) return 0;
+
+    return static_cast<std::size_t>(info.st_size);
+}
+
+static void roundTrip(const std::string& path)
+{
+    const std::size_t count = 1000;
+
+    {
+        MappedVector<Record> records(path);
+        CHECK(records.isEmpty());
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            records.push_back(Record{ i, static_cast<double>(i) * 0.5 });
+        }
+
+        records.sync();
+    }
+
+    CHECK(fileSize(path) == count * sizeof(Record));
+
+    {
+        MappedVector<Record> records(path);
+        CHECK(records.getSize() == count);
+
+        bool intact = true;
+        for (std::size_t i = 0; i < records.getSize(); i++)
+        {
+            intact = intact && records[i].id == i && records[i].value == static_cast<double>(i) * 0.5;
+        }
+
+        CHECK(intact);
+
+        for (std::size_t i = count; i < 3 * count; i++)
+        {
+            records.emplace_back(Record{ i, static_cast<double>(i) * 0.5 });
+        }
+
+        CHECK(records.getSize() == 3 * count);
+        CHECK(records.getCapacity() >= 3 * count);
+        CHECK(records.front().id == 0);
+        CHECK(records.back().id == 3 * count - 1);
+    }
+
+    CHECK(fileSize(path) == 3 * count * sizeof(Record));
+
+    {
+        MappedVector<Record> records(path);
+        CHECK(records.getSize() == 3 * count);
+        CHECK(records.back().id == 3 * count - 1);
+    }
+}
+
+static void rejectsPartialRecord(const std::string& path)
+{
+    int fd = ::open(path.c_str(), O_WRONLY | O_TRUNC);
+    CHECK(fd >= 0);
+
+    const char bytes[sizeof(Record) + 3] = {};
+    CHECK(::write(fd, bytes, sizeof(bytes)) == static_cast<ssize_t>(sizeof(bytes)));
+    ::close(fd);
+
+    bool threw = false;
+
+    try
+    {
+        MappedVector<Record> records(path);
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+
+    CHECK(threw);
+    CHECK(fileSize(path) == sizeof(bytes));
+}
+
+int main()
+{
+    std::string path = temporaryPath();
+
+    roundTrip(path);
+    rejectsPartialRecord(path);
+
+    ::unlink(path.c_str());
+
+    return Check::result();
+}
@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "../Parallel/Algorithms.hpp"
+
+#include "Check.hpp"
+
+static void matchesSerial()
+{
+    ThreadPool pool(4);
+
+    std::vector<std::uint64_t> values(1 << 18);
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = (i * 2654435761u) % 100003;
+    }
+
+    std::vector<std::uint64_t> doubled(values.size());
+    Parallel::transform(pool, values.begin(), values.end(), doubled.begin(), [](std::uint64_t val) { return val * 2; });
+
+    std::uint64_t expected = std::accumulate(values.begin(), values.end(), std::uint64_t(0));
+    CHECK(Parallel::reduce(pool, doubled.begin(), doubled.end(), std::uint64_t(0)) == expected * 2);
+
+    Parallel::sort(pool, values.begin(), values.end());
+    CHECK(std::is_sorted(values.begin(), values.end()));
+}
+
+static void nestedCallsComplete()
+{
+    ThreadPool pool(2);
+    std::vector<std::future<std::uint64_t>> results;
+
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        results.push_back(pool.submit([&pool]()
+        {
+            std::vector<std::uint64_t> values(1 << 17, 1);
+            Parallel::sort(pool, values.begin(), values.end());
+            return Parallel::reduce(pool, values.begin(), values.end(), std::uint64_t(0));
+        }));
+    }
+
+    for (std::future<std::uint64_t>& result : results)
+    {
+        CHECK(result.get() == (1 << 17));
+    }
+}
+
+static void propagatesExceptions()
+{
+    ThreadPool pool(4);
+    std::vector<int> values(1 << 18, 0);
+
+    bool threw = false;
+
+    try
+    {
+        Parallel::for_each(pool, values.begin(), values.end(), [](int val)
+        {
+            if (val == 0) throw std::runtime_error("chunk failed");
+        });
+    }
+    catch (const std::runtime_error&)
+    {
+        threw = true;
+    }
+
+    CHECK(threw);
+}
+
+int main()
+{
+    matchesSerial();
+    nestedCallsComplete();
+    propagatesExceptions();
+
+    return Check::result();
+}
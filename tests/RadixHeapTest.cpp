@@ -0,0 +1,126 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../PriorityQueue/RadixHeap.hpp"
+
+#include "Check.hpp"
+
+static void matchesReference()
+{
+    RadixHeap<std::uint32_t> heap;
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>, std::greater<std::uint32_t>> reference;
+
+    std::mt19937 rng(7);
+    std::uint32_t floor = 0;
+
+    for (std::size_t i = 0; i < 200000; i++)
+    {
+        if (reference.empty() || rng() % 3 != 0)
+        {
+            std::uint32_t key = floor + static_cast<std::uint32_t>(rng() % 5000);
+
+            heap.push(key);
+            reference.push(key);
+        }
+        else
+        {
+            floor = reference.top();
+
+            std::uint32_t out = 0;
+            heap.pop(out);
+            reference.pop();
+
+            CHECK(out == floor);
+        }
+
+        CHECK(heap.size() == reference.size());
+        if (!reference.empty()) CHECK(heap.top() == reference.top());
+    }
+}
+
+static void keyedPairs()
+{
+    RadixHeap<std::pair<std::uint64_t, int>> heap;
+
+    heap.push({ 40, 4 }).push({ 10, 1 }).push({ 30, 3 }).push({ 20, 2 });
+
+    int expected = 1;
+    while (!heap.empty())
+    {
+        CHECK(heap.top().second == expected++);
+        heap.pop();
+    }
+
+    bool threw = false;
+    heap.push({ 50, 5 }).pop();
+
+    try
+    {
+        heap.push({ 49, 0 });
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+
+    CHECK(threw);
+}
+
+static double interleaved(std::size_t n)
+{
+    double best = 0;
+
+    for (std::size_t run = 0; run < 3; run++)
+    {
+        RadixHeap<std::uint64_t> heap;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            heap.push((std::uint64_t(1) << 40) + i);
+        }
+
+        std::uint64_t floor = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            heap.push(floor + 1);
+
+            std::uint64_t out = 0;
+            heap.pop(out);
+
+            CHECK(out == floor + 1);
+            floor = out;
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (run == 0 || elapsed.count() < best) best = elapsed.count();
+
+        CHECK(heap.size() == n);
+    }
+
+    return best;
+}
+
+static void interleavedScalesLinearly()
+{
+    double small = interleaved(2000);
+    double large = interleaved(16000);
+
+    CHECK(large < 24 * small + 0.05);
+}
+
+int main()
+{
+    matchesReference();
+    keyedPairs();
+    interleavedScalesLinearly();
+
+    return Check::result();
+}
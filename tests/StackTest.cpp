@@ -0,0 +1,165 @@
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../Stack/FixedStack.hpp"
+#include "../Stack/SmallStack.hpp"
+
+#include "Check.hpp"
+
+struct Tracked
+{
+    static int live;
+
+    std::string value;
+
+    Tracked(std::string val) : value(std::move(val)) { live++; }
+    Tracked(const Tracked& other) : value(other.value) { live++; }
+    Tracked(Tracked&& other) noexcept : value(std::move(other.value)) { live++; }
+    Tracked& operator=(const Tracked& other) = default;
+    Tracked& operator=(Tracked&& other) noexcept = default;
+    ~Tracked() { live--; }
+};
+
+int Tracked::live = 0;
+
+static std::string label(std::size_t i)
+{
+    return "element-" + std::to_string(i) + "-with-a-heap-allocated-payload";
+}
+
+static void smallStackSpill()
+{
+    SmallStack<int, 4> stack;
+
+    for (int i = 0; i < 4; i++) stack.push(i);
+
+    CHECK(stack.isInline());
+    CHECK(stack.getCapacity() == 4);
+
+    for (int i = 4; i < 100; i++) stack.push(i);
+
+    CHECK(!stack.isInline());
+    CHECK(stack.getSize() == 100);
+
+    for (int i = 99; i >= 0; i--)
+    {
+        CHECK(stack.top() == i);
+        stack.pop();
+    }
+
+    CHECK(stack.isEmpty());
+}
+
+static void smallStackMove()
+{
+    {
+        SmallStack<Tracked, 4> inlined;
+        for (std::size_t i = 0; i < 3; i++) inlined.emplace(label(i));
+
+        SmallStack<Tracked, 4> moved(std::move(inlined));
+
+        CHECK(inlined.isEmpty() && inlined.isInline());
+        CHECK(moved.isInline() && moved.getSize() == 3);
+        CHECK(moved.top().value == label(2));
+
+        SmallStack<Tracked, 4> spilled;
+        for (std::size_t i = 0; i < 10; i++) spilled.emplace(label(i));
+
+        const Tracked* buffer = &spilled.top();
+        moved = std::move(spilled);
+
+        CHECK(spilled.isEmpty() && spilled.isInline());
+        CHECK(!moved.isInline() && moved.getSize() == 10);
+        CHECK(&moved.top() == buffer);
+
+        SmallStack<Tracked, 4> copied(moved);
+
+        CHECK(copied.getSize() == 10);
+        for (std::size_t i = 10; i-- > 0;)
+        {
+            CHECK(copied.top().value == label(i));
+            copied.pop();
+        }
+
+        CHECK(Tracked::live == 10);
+    }
+
+    CHECK(Tracked::live == 0);
+}
+
+static void fixedStackCapacity()
+{
+    FixedStack<int, 8> stack;
+
+    for (int i = 0; i < 8; i++) CHECK(stack.try_push(i));
+
+    CHECK(stack.isFull());
+    CHECK(!stack.try_push(8));
+    CHECK(!stack.try_emplace(8));
+
+    bool threw = false;
+    try
+    {
+        stack.push(8);
+    }
+    catch (const std::length_error&)
+    {
+        threw = true;
+    }
+
+    CHECK(threw);
+    CHECK(stack.getSize() == 8 && stack.top() == 7);
+
+    stack.pop_n(6);
+
+    int values[] = { 10, 11, 12, 13, 14, 15, 16 };
+    threw = false;
+    try
+    {
+        stack.push_range(values, values + 7);
+    }
+    catch (const std::length_error&)
+    {
+        threw = true;
+    }
+
+    CHECK(threw);
+    CHECK(stack.getSize() == 2 && stack.top() == 1);
+
+    stack.push_range(values, values + 6);
+
+    CHECK(stack.isFull() && stack.top() == 15);
+}
+
+static void fixedStackMove()
+{
+    {
+        FixedStack<Tracked, 8> stack;
+        for (std::size_t i = 0; i < 5; i++) stack.emplace(label(i));
+
+        FixedStack<Tracked, 8> moved(std::move(stack));
+
+        CHECK(stack.isEmpty());
+        CHECK(moved.getSize() == 5 && moved.top().value == label(4));
+
+        FixedStack<Tracked, 8> copied;
+        copied = moved;
+
+        CHECK(copied.getSize() == 5 && copied.top().value == label(4));
+        CHECK(Tracked::live == 10);
+    }
+
+    CHECK(Tracked::live == 0);
+}
+
+int main()
+{
+    smallStackSpill();
+    smallStackMove();
+    fixedStackCapacity();
+    fixedStackMove();
+
+    return Check::result();
+}